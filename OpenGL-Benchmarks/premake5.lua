@@ -0,0 +1,79 @@
+project "OpenGL-Benchmarks"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+	staticruntime "on"
+
+	targetdir ("../bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("../bin-int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"src/**.h",
+		"src/**.cpp"
+	}
+
+	includedirs
+	{
+		"../OpenGL-Core/vendor/spdlog/include",
+		"../OpenGL-Core/src",
+		"../OpenGL-Core/vendor",
+		"../OpenGL-Core/%{IncludeDir.glm}",
+		"../OpenGL-Core/%{IncludeDir.Glad}",
+		"../OpenGL-Core/%{IncludeDir.ImGui}",
+		"../OpenGL-Core/%{IncludeDir.GLFW}"
+	}
+
+	defines
+	{
+		"SPDLOG_COMPILED_LIB"
+	}
+
+	links
+	{
+		"OpenGL-Core"
+	}
+
+	-- Runs started from the IDE keep their results next to the binaries
+	debugargs { "--output", "../bin/benchmark-results/%{cfg.buildcfg}.json" }
+
+	filter "system:windows"
+		systemversion "latest"
+
+		defines
+		{
+			"GLCORE_PLATFORM_WINDOWS"
+		}
+
+	filter "system:linux"
+		defines
+		{
+			"GLCORE_PLATFORM_LINUX"
+		}
+
+		-- Static libraries do not carry their dependencies on Linux, and GNU ld
+		-- resolves symbols left to right
+		links
+		{
+			"GLFW",
+			"Glad",
+			"ImGui",
+			"GL",
+			"X11",
+			"Xrandr",
+			"Xi",
+			"Xcursor",
+			"Xinerama",
+			"dl",
+			"pthread"
+		}
+
+	filter "configurations:Debug"
+		defines "GLCORE_DEBUG"
+		runtime "Debug"
+		symbols "on"
+
+	filter "configurations:Release"
+		defines "GLCORE_RELEASE"
+		runtime "Release"
+        optimize "on"
@@ -0,0 +1,151 @@
+#include "GLCore.h"
+#include "GLCoreUtils.h"
+
+#include "Benchmark.h"
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace GLCore;
+using namespace GLCore::Utils;
+
+namespace {
+
+	std::string GetAssetBenchmarkPath(const char* name)
+	{
+		return (std::filesystem::temp_directory_path() / name).string();
+	}
+
+	// UV sphere with positions, texture coordinates and normals, written the
+	// way DCC tools export OBJ
+	void WriteSphereOBJ(const std::string& filepath, uint32_t segments)
+	{
+		std::ofstream out(filepath, std::ios::out | std::ios::trunc);
+		const float pi = 3.14159265f;
+		for (uint32_t ring = 0; ring <= segments; ring++)
+		{
+			float theta = pi * (float)ring / (float)segments;
+			for (uint32_t segment = 0; segment <= segments; segment++)
+			{
+				float phi = 2.0f * pi * (float)segment / (float)segments;
+				float x = std::sin(theta) * std::cos(phi), y = std::cos(theta), z = std::sin(theta) * std::sin(phi);
+				out << "v " << x << ' ' << y << ' ' << z << '\n';
+				out << "vt " << (float)segment / (float)segments << ' ' << (float)ring / (float)segments << '\n';
+				out << "vn " << x << ' ' << y << ' ' << z << '\n';
+			}
+		}
+
+		for (uint32_t ring = 0; ring < segments; ring++)
+		{
+			for (uint32_t segment = 0; segment < segments; segment++)
+			{
+				uint32_t a = ring * (segments + 1) + segment + 1, b = a + segments + 1;
+				out << "f " << a << '/' << a << '/' << a << ' ' << b << '/' << b << '/' << b << ' '
+					<< b + 1 << '/' << b + 1 << '/' << b + 1 << ' ' << a + 1 << '/' << a + 1 << '/' << a + 1 << '\n';
+			}
+		}
+	}
+
+	struct SphereAsset
+	{
+		std::string SourcePath = GetAssetBenchmarkPath("glcore-benchmark-sphere.obj");
+		std::string CookedPath = GetCookedMeshPath(SourcePath);
+
+		SphereAsset()
+		{
+			WriteSphereOBJ(SourcePath, 256);
+			CookMesh(SourcePath, CookedPath);
+		}
+
+		~SphereAsset()
+		{
+			std::error_code error;
+			std::filesystem::remove(SourcePath, error);
+			std::filesystem::remove(CookedPath, error);
+		}
+	};
+
+}
+
+// Time until vertex and index data sit in memory ready for upload; the
+// cooked variant copies out of the mapping as the driver would
+GLCORE_BENCHMARK(Mesh, Load)
+{
+	SphereAsset sphere;
+
+	MeshData data;
+	if (!ImportOBJ(sphere.SourcePath, data))
+	{
+		state.Skip("could not import the generated OBJ");
+		return;
+	}
+
+	state.SetItemsPerIteration(data.Indices.size() / 3);
+	state.Run("parse OBJ", [&]()
+	{
+		ImportOBJ(sphere.SourcePath, data);
+		Benchmarks::DoNotOptimize(data.Vertices.back());
+	});
+
+	std::vector<uint8_t> staging;
+	state.Run("map cooked", [&]()
+	{
+		MappedFile file(sphere.CookedPath);
+		const CookedMeshHeader* header = ValidateCookedMesh(file.GetData(), file.GetSize());
+		staging.resize(file.GetSize() - header->VertexOffset);
+		memcpy(staging.data(), file.GetData() + header->VertexOffset, staging.size());
+		Benchmarks::DoNotOptimize(staging.back());
+	});
+}
+
+// Source file to GL buffers
+GLCORE_GL_BENCHMARK(Mesh, LoadToGPU)
+{
+	SphereAsset sphere;
+
+	state.Run("parse OBJ", [&]()
+	{
+		MeshData data;
+		ImportOBJ(sphere.SourcePath, data);
+		delete Mesh::FromMeshData(data);
+	}, []() { glFinish(); });
+
+	state.Run("map cooked", [&]()
+	{
+		delete Mesh::FromCookedFile(sphere.CookedPath);
+	}, []() { glFinish(); });
+}
+
+// Load() of a resident asset is the common case once a level is up; the
+// cold variant includes the worker decode and the budgeted upload
+GLCORE_GL_BENCHMARK(AssetManager, Load)
+{
+	SphereAsset sphere;
+	AssetManager assets;
+
+	AssetHandle<Mesh> resident = assets.Load<Mesh>(sphere.SourcePath);
+	assets.WaitForAll();
+	if (!resident.IsReady())
+	{
+		state.Skip("could not load the generated mesh");
+		return;
+	}
+
+	state.Run("resident", [&]()
+	{
+		AssetHandle<Mesh> handle = assets.Load<Mesh>(sphere.SourcePath);
+		Benchmarks::DoNotOptimize(handle.Get());
+	});
+
+	resident.Reset();
+	state.Run("cold", [&]()
+	{
+		AssetHandle<Mesh> handle = assets.Load<Mesh>(sphere.SourcePath);
+		assets.WaitForAll();
+		Benchmarks::DoNotOptimize(handle.Get());
+		handle.Reset();
+		assets.CollectGarbage();
+	}, []() { glFinish(); });
+}
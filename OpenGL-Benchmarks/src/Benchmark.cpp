@@ -0,0 +1,158 @@
+#include "Benchmark.h"
+
+#include <GLCore/Core/Log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+
+namespace Benchmarks {
+
+	std::vector<BenchmarkInfo>& GetRegisteredBenchmarks()
+	{
+		static std::vector<BenchmarkInfo> s_Benchmarks;
+		return s_Benchmarks;
+	}
+
+	// Linear interpolation between closest ranks; values must be sorted
+	static double Percentile(const std::vector<double>& values, double percentile)
+	{
+		double rank = percentile / 100.0 * (double)(values.size() - 1);
+		size_t lower = (size_t)rank;
+		size_t upper = std::min(lower + 1, values.size() - 1);
+		return values[lower] + (values[upper] - values[lower]) * (rank - (double)lower);
+	}
+
+	void BenchmarkState::Skip(const std::string& reason)
+	{
+		BenchmarkResult result;
+		result.Name = m_Name;
+		result.Skipped = reason;
+		m_Results.push_back(result);
+
+		LOG_WARN("{0}: skipped ({1})", m_Name, reason);
+	}
+
+	void BenchmarkState::Measure(const std::string& variant, const std::function<double(uint64_t)>& sample)
+	{
+		BenchmarkResult result;
+		result.Name = variant.empty() ? m_Name : m_Name + "/" + variant;
+		result.WarmupSamples = m_Settings.WarmupSamples;
+		result.Samples = m_SampleOverride ? m_SampleOverride : std::max(m_Settings.Samples, 1u);
+		result.ItemsPerIteration = m_ItemsPerIteration;
+
+		// Grow the batch until one sample reaches the minimum sample time
+		uint64_t iterations = m_FixedIterations;
+		if (!iterations)
+		{
+			iterations = 1;
+			while (true)
+			{
+				double elapsed = sample(iterations);
+				if (elapsed >= m_Settings.MinSampleTime || iterations >= (1ull << 30))
+					break;
+
+				double scale = elapsed > 0.0 ? m_Settings.MinSampleTime * 1.2 / elapsed : 10.0;
+				iterations = std::max(iterations + 1, (uint64_t)((double)iterations * std::min(scale, 10.0)));
+			}
+		}
+		result.IterationsPerSample = iterations;
+
+		for (uint32_t i = 0; i < result.WarmupSamples; i++)
+			sample(iterations);
+
+		std::vector<double> times(result.Samples);
+		for (double& time : times)
+			time = sample(iterations) * 1e9 / (double)iterations;
+
+		std::sort(times.begin(), times.end());
+
+		double sum = 0.0;
+		for (double time : times)
+			sum += time;
+		result.Mean = sum / (double)times.size();
+
+		double squares = 0.0;
+		for (double time : times)
+			squares += (time - result.Mean) * (time - result.Mean);
+		result.StdDev = times.size() > 1 ? std::sqrt(squares / (double)(times.size() - 1)) : 0.0;
+
+		result.Min = times.front();
+		result.Max = times.back();
+		result.P50 = Percentile(times, 50.0);
+		result.P90 = Percentile(times, 90.0);
+		result.P99 = Percentile(times, 99.0);
+
+		LOG_INFO("{0:<48} {1:>12.1f} ns  +-{2:>5.1f}%  p99 {3:>12.1f} ns  ({4} x {5})", result.Name, result.Mean,
+			result.Mean > 0.0 ? 100.0 * result.StdDev / result.Mean : 0.0, result.P99, result.Samples, result.IterationsPerSample);
+
+		m_Results.push_back(result);
+	}
+
+	static std::string EscapeJSON(const std::string& text)
+	{
+		std::string result;
+		for (char c : text)
+		{
+			if (c == '"' || c == '\\')
+				result += '\\';
+			if ((unsigned char)c < 0x20)
+				continue;
+			result += c;
+		}
+		return result;
+	}
+
+	bool WriteResultsJSON(const std::string& filepath, const std::vector<BenchmarkResult>& results, const std::vector<std::pair<std::string, std::string>>& context)
+	{
+		std::filesystem::path path(filepath);
+		std::error_code error;
+		if (path.has_parent_path())
+			std::filesystem::create_directories(path.parent_path(), error);
+
+		std::ofstream out(path);
+		if (!out)
+		{
+			LOG_ERROR("Could not write benchmark results to '{0}'", filepath);
+			return false;
+		}
+
+		out.precision(17);
+		out << "{\n\t\"context\": {";
+		for (size_t i = 0; i < context.size(); i++)
+			out << (i ? ",\n" : "\n") << "\t\t\"" << EscapeJSON(context[i].first) << "\": \"" << EscapeJSON(context[i].second) << "\"";
+		out << "\n\t},\n\t\"benchmarks\": [";
+
+		for (size_t i = 0; i < results.size(); i++)
+		{
+			const BenchmarkResult& result = results[i];
+			out << (i ? ",\n" : "\n") << "\t\t{ \"name\": \"" << EscapeJSON(result.Name) << "\"";
+
+			if (!result.Skipped.empty())
+			{
+				out << ", \"skipped\": \"" << EscapeJSON(result.Skipped) << "\" }";
+				continue;
+			}
+
+			out << ", \"unit\": \"ns\""
+				<< ", \"warmup\": " << result.WarmupSamples
+				<< ", \"repetitions\": " << result.Samples
+				<< ", \"iterations\": " << result.IterationsPerSample
+				<< ", \"mean\": " << result.Mean
+				<< ", \"stddev\": " << result.StdDev
+				<< ", \"min\": " << result.Min
+				<< ", \"max\": " << result.Max
+				<< ", \"p50\": " << result.P50
+				<< ", \"p90\": " << result.P90
+				<< ", \"p99\": " << result.P99;
+			if (result.ItemsPerIteration && result.Mean > 0.0)
+				out << ", \"items_per_second\": " << (double)result.ItemsPerIteration * 1e9 / result.Mean;
+			out << " }";
+		}
+
+		out << "\n\t]\n}\n";
+		return (bool)out;
+	}
+
+}
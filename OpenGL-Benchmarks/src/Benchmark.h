@@ -0,0 +1,138 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Benchmarks {
+
+	struct BenchmarkSettings
+	{
+		uint32_t WarmupSamples = 3;
+		uint32_t Samples = 20;
+		// Iterations per sample are calibrated so a sample takes at least this long
+		double MinSampleTime = 0.005; // seconds
+
+		// Event recording replayed by Events/Replay, skipped when empty
+		std::string ReplayPath;
+	};
+
+	// Timings of one measured loop, per iteration, in nanoseconds
+	struct BenchmarkResult
+	{
+		std::string Name;
+		std::string Skipped; // Reason, empty if the benchmark ran
+
+		uint32_t WarmupSamples = 0, Samples = 0;
+		uint64_t IterationsPerSample = 0;
+		uint64_t ItemsPerIteration = 0;
+
+		double Mean = 0.0, StdDev = 0.0, Min = 0.0, Max = 0.0;
+		double P50 = 0.0, P90 = 0.0, P99 = 0.0;
+	};
+
+	// Handed to each benchmark function. Setup and teardown happen around
+	// Run(), which times only the iteration function; a benchmark may call
+	// Run() several times to report variants (thread counts, sizes, ...).
+	class BenchmarkState
+	{
+	public:
+		BenchmarkState(const std::string& name, const BenchmarkSettings& settings)
+			: m_Name(name), m_Settings(settings) {}
+
+		const BenchmarkSettings& GetSettings() const { return m_Settings; }
+
+		// Adds items/s to the following results
+		void SetItemsPerIteration(uint64_t items) { m_ItemsPerIteration = items; }
+		// Fixes the batch size instead of calibrating it; 1 reports the
+		// distribution of single calls (tail latency)
+		void SetIterationsPerSample(uint64_t iterations) { m_FixedIterations = iterations; }
+		// Overrides the configured sample count for the following results
+		void SetSamples(uint32_t samples) { m_SampleOverride = samples; }
+
+		// endSample runs inside the timed region once per sample, e.g. a
+		// glFinish() so the GPU work of the batch is included
+		template<typename F, typename G>
+		void Run(const std::string& variant, F&& iteration, G&& endSample)
+		{
+			Measure(variant, [&](uint64_t iterations)
+			{
+				auto start = std::chrono::steady_clock::now();
+				for (uint64_t i = 0; i < iterations; i++)
+					iteration();
+				endSample();
+				return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			});
+		}
+
+		template<typename F>
+		void Run(const std::string& variant, F&& iteration) { Run(variant, std::forward<F>(iteration), []() {}); }
+
+		template<typename F>
+		void Run(F&& iteration) { Run("", std::forward<F>(iteration), []() {}); }
+
+		void Skip(const std::string& reason);
+
+		const std::vector<BenchmarkResult>& GetResults() const { return m_Results; }
+	private:
+		// sample(iterations) returns the elapsed seconds
+		void Measure(const std::string& variant, const std::function<double(uint64_t)>& sample);
+	private:
+		std::string m_Name;
+		const BenchmarkSettings& m_Settings;
+
+		uint64_t m_ItemsPerIteration = 0;
+		uint64_t m_FixedIterations = 0;
+		uint32_t m_SampleOverride = 0;
+
+		std::vector<BenchmarkResult> m_Results;
+	};
+
+	using BenchmarkFunction = void(*)(BenchmarkState& state);
+
+	struct BenchmarkInfo
+	{
+		std::string Name;
+		BenchmarkFunction Function;
+		bool RequiresGL;
+	};
+
+	std::vector<BenchmarkInfo>& GetRegisteredBenchmarks();
+
+	struct BenchmarkRegistration
+	{
+		BenchmarkRegistration(const char* name, BenchmarkFunction function, bool requiresGL)
+		{
+			GetRegisteredBenchmarks().push_back({ name, function, requiresGL });
+		}
+	};
+
+	// Keeps the optimizer from discarding a computed value
+	template<typename T>
+	inline void DoNotOptimize(const T& value)
+	{
+	#if defined(_MSC_VER)
+		static volatile const void* s_Sink;
+		s_Sink = &value;
+	#else
+		asm volatile("" : : "r,m"(value) : "memory");
+	#endif
+	}
+
+	// Writes results as JSON; the parent directory is created if needed
+	bool WriteResultsJSON(const std::string& filepath, const std::vector<BenchmarkResult>& results, const std::vector<std::pair<std::string, std::string>>& context);
+
+}
+
+#define GLCORE_BENCHMARK_IMPL(group, name, requiresGL) \
+	static void GLCoreBenchmark_##group##_##name(::Benchmarks::BenchmarkState& state); \
+	static ::Benchmarks::BenchmarkRegistration s_GLCoreBenchmarkRegistration_##group##_##name(#group "/" #name, GLCoreBenchmark_##group##_##name, requiresGL); \
+	static void GLCoreBenchmark_##group##_##name(::Benchmarks::BenchmarkState& state)
+
+// Registers a benchmark named "group/name":
+//   GLCORE_BENCHMARK(Events, Dispatch) { ...setup...; state.Run([&]() { ... }); }
+#define GLCORE_BENCHMARK(group, name) GLCORE_BENCHMARK_IMPL(group, name, false)
+// Same, but only runs when a GL context is available (current on the calling thread)
+#define GLCORE_GL_BENCHMARK(group, name) GLCORE_BENCHMARK_IMPL(group, name, true)
@@ -0,0 +1,143 @@
+#include "GLCore.h"
+#include "GLCoreUtils.h"
+
+#include "Benchmark.h"
+
+#include <cstring>
+#include <ctime>
+#include <iostream>
+
+using namespace GLCore;
+using namespace Benchmarks;
+
+static void PrintUsage()
+{
+	std::cout <<
+		"Usage: OpenGL-Benchmarks [options]\n"
+		"  --output <file>        Write results as JSON\n"
+		"  --filter <text>        Only run benchmarks whose name contains text\n"
+		"  --warmup <n>           Discarded samples per benchmark (default 3)\n"
+		"  --repetitions <n>      Measured samples per benchmark (default 20)\n"
+		"  --min-time <ms>        Minimum duration of one sample (default 5)\n"
+		"  --replay <file>        Event recording used by Events/Replay\n"
+		"  --no-gl                Skip benchmarks that need an OpenGL context\n"
+		"  --list                 Print benchmark names and exit\n";
+}
+
+static const char* GetBuildConfiguration()
+{
+#if defined(GLCORE_DEBUG)
+	return "Debug";
+#elif defined(GLCORE_PROFILE)
+	return "Profile";
+#else
+	return "Release";
+#endif
+}
+
+static std::string GetTimestamp()
+{
+	std::time_t now = std::time(nullptr);
+	char buffer[32];
+	std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+	return buffer;
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkSettings settings;
+	std::string outputPath, filter;
+	bool useGL = true, listOnly = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		bool hasValue = i + 1 < argc;
+
+		if (!strcmp(arg, "--output") && hasValue)
+			outputPath = argv[++i];
+		else if (!strcmp(arg, "--filter") && hasValue)
+			filter = argv[++i];
+		else if (!strcmp(arg, "--warmup") && hasValue)
+			settings.WarmupSamples = (uint32_t)std::stoul(argv[++i]);
+		else if (!strcmp(arg, "--repetitions") && hasValue)
+			settings.Samples = (uint32_t)std::stoul(argv[++i]);
+		else if (!strcmp(arg, "--min-time") && hasValue)
+			settings.MinSampleTime = std::stod(argv[++i]) / 1000.0;
+		else if (!strcmp(arg, "--replay") && hasValue)
+			settings.ReplayPath = argv[++i];
+		else if (!strcmp(arg, "--no-gl"))
+			useGL = false;
+		else if (!strcmp(arg, "--list"))
+			listOnly = true;
+		else
+		{
+			PrintUsage();
+			return !strcmp(arg, "--help") ? 0 : 1;
+		}
+	}
+
+	std::vector<BenchmarkInfo> benchmarks = GetRegisteredBenchmarks();
+	std::sort(benchmarks.begin(), benchmarks.end(), [](const BenchmarkInfo& a, const BenchmarkInfo& b) { return a.Name < b.Name; });
+	benchmarks.erase(std::remove_if(benchmarks.begin(), benchmarks.end(),
+		[&](const BenchmarkInfo& info) { return info.Name.find(filter) == std::string::npos; }), benchmarks.end());
+
+	if (listOnly)
+	{
+		for (const BenchmarkInfo& info : benchmarks)
+			std::cout << info.Name << (info.RequiresGL ? " (GL)" : "") << "\n";
+		return 0;
+	}
+
+	Log::Init();
+	JobSystem::Init();
+
+	std::vector<std::pair<std::string, std::string>> context = {
+		{ "date", GetTimestamp() },
+		{ "build", GetBuildConfiguration() },
+		{ "threads", std::to_string(JobSystem::GetThreadCount()) },
+		{ "simd", Utils::SIMDLevelToString(Utils::GetSIMDLevel()) }
+	};
+
+	// A hidden window provides the context; without a display or a 4.5
+	// context the GL benchmarks are reported as skipped
+	std::unique_ptr<Window> window;
+	if (useGL)
+		window = std::unique_ptr<Window>(Window::Create({ "OpenGL Benchmarks", 1280, 720, false }));
+
+	if (window)
+	{
+		window->SetEventCallback([](Event&) {});
+		window->SetVSync(false);
+
+		context.push_back({ "gl_vendor", (const char*)glGetString(GL_VENDOR) });
+		context.push_back({ "gl_renderer", (const char*)glGetString(GL_RENDERER) });
+		context.push_back({ "gl_version", (const char*)glGetString(GL_VERSION) });
+	}
+	else if (useGL)
+	{
+		LOG_WARN("Could not create an OpenGL context, OpenGL benchmarks are skipped");
+	}
+
+	std::vector<BenchmarkResult> results;
+	for (const BenchmarkInfo& info : benchmarks)
+	{
+		BenchmarkState state(info.Name, settings);
+		if (info.RequiresGL && !window)
+			state.Skip("no OpenGL context");
+		else
+			info.Function(state);
+
+		results.insert(results.end(), state.GetResults().begin(), state.GetResults().end());
+	}
+
+	bool success = outputPath.empty() || WriteResultsJSON(outputPath, results, context);
+	if (success && !outputPath.empty())
+		LOG_INFO("Wrote {0} results to {1}", results.size(), outputPath);
+
+	window.reset();
+	JobSystem::Shutdown();
+	Log::Shutdown();
+
+	return success ? 0 : 1;
+}
@@ -0,0 +1,252 @@
+#include "GLCore.h"
+#include "GLCore/Core/AsyncLogSink.h"
+#include "GLCore/Events/KeyEvent.h"
+#include "GLCore/Events/MouseEvent.h"
+
+#include "Benchmark.h"
+
+#include "spdlog/sinks/basic_file_sink.h"
+
+#include <filesystem>
+#include <thread>
+
+using namespace GLCore;
+
+namespace {
+
+	// Does the same kind of work a typical layer does per event and update
+	class BenchmarkLayer : public Layer
+	{
+	public:
+		BenchmarkLayer() : Layer("BenchmarkLayer") {}
+
+		virtual void OnUpdate(Timestep ts) override { m_Time += ts; }
+
+		virtual void OnEvent(Event& event) override
+		{
+			EventDispatcher dispatcher(event);
+			dispatcher.Dispatch<MouseMovedEvent>([&](MouseMovedEvent& e) { m_MouseX = e.GetX(); return false; });
+			dispatcher.Dispatch<MouseScrolledEvent>([&](MouseScrolledEvent& e) { m_Scroll += e.GetYOffset(); return false; });
+			dispatcher.Dispatch<KeyPressedEvent>([&](KeyPressedEvent& e) { m_Keys++; return false; });
+			dispatcher.Dispatch<WindowResizeEvent>([&](WindowResizeEvent& e) { m_Resizes++; return false; });
+		}
+
+		float GetTime() const { return m_Time; }
+	private:
+		float m_Time = 0.0f, m_MouseX = 0.0f, m_Scroll = 0.0f;
+		uint32_t m_Keys = 0, m_Resizes = 0;
+	};
+
+	std::string GetLogBenchmarkPath(const char* name)
+	{
+		return (std::filesystem::temp_directory_path() / name).string();
+	}
+
+}
+
+GLCORE_BENCHMARK(Events, Dispatch)
+{
+	LayerStack layers;
+	for (int i = 0; i < 8; i++)
+		layers.PushLayer(std::make_unique<BenchmarkLayer>());
+
+	float x = 0.0f;
+	state.SetItemsPerIteration(4);
+	state.Run([&]()
+	{
+		MouseMovedEvent moved(x, x);
+		MouseScrolledEvent scrolled(0.0f, 1.0f);
+		KeyPressedEvent key(65, 0);
+		WindowResizeEvent resize(1280, 720);
+
+		layers.OnEvent(moved);
+		layers.OnEvent(scrolled);
+		layers.OnEvent(key);
+		layers.OnEvent(resize);
+		x += 1.0f;
+	});
+}
+
+GLCORE_BENCHMARK(Events, Replay)
+{
+	if (state.GetSettings().ReplayPath.empty())
+	{
+		state.Skip("no --replay recording");
+		return;
+	}
+
+	EventReplay replay;
+	if (!replay.Load(state.GetSettings().ReplayPath))
+	{
+		state.Skip("could not load recording");
+		return;
+	}
+
+	LayerStack layers;
+	for (int i = 0; i < 8; i++)
+		layers.PushLayer(std::make_unique<BenchmarkLayer>());
+
+	uint64_t eventCount = 0;
+	for (const RecordedFrame& frame : replay.GetFrames())
+		eventCount += frame.Events.size();
+
+	auto callback = [&](Event& event) { layers.OnEvent(event); };
+	state.SetItemsPerIteration(eventCount);
+	state.Run([&]()
+	{
+		for (const RecordedFrame& frame : replay.GetFrames())
+		{
+			for (const RecordedEvent& event : frame.Events)
+				EventReplay::Dispatch(event, callback);
+			layers.OnUpdate(frame.Timestep);
+		}
+	});
+}
+
+GLCORE_BENCHMARK(LayerStack, Update)
+{
+	for (uint32_t layerCount : { 4, 16, 64 })
+	{
+		LayerStack layers;
+		for (uint32_t i = 0; i < layerCount; i++)
+			layers.PushLayer(std::make_unique<BenchmarkLayer>());
+
+		state.SetItemsPerIteration(layerCount);
+		state.Run(std::to_string(layerCount) + " layers", [&]() { layers.OnUpdate(0.016f); });
+	}
+}
+
+// Half the layers disabled, a quarter updating every 4th frame
+GLCORE_BENCHMARK(LayerStack, UpdateSparse)
+{
+	LayerStack layers;
+	for (uint32_t i = 0; i < 64; i++)
+	{
+		Layer* layer = layers.PushLayer(std::make_unique<BenchmarkLayer>());
+		if (i % 2)
+			layers.SetEnabled(layer, false);
+		else if (i % 4 == 2)
+			layers.SetUpdateDivisor(layer, 4);
+	}
+
+	state.SetItemsPerIteration(64);
+	state.Run([&]() { layers.OnUpdate(0.016f); });
+}
+
+GLCORE_BENCHMARK(LayerStack, PushPop)
+{
+	LayerStack layers;
+	for (int i = 0; i < 16; i++)
+		layers.PushLayer(std::make_unique<BenchmarkLayer>(), i % 4);
+	layers.PushOverlay(std::make_unique<BenchmarkLayer>());
+
+	state.Run([&]() { layers.PopLayer(layers.PushLayer(std::make_unique<BenchmarkLayer>(), 2)); });
+}
+
+GLCORE_BENCHMARK(Jobs, ParallelFor)
+{
+	std::vector<float> values(1 << 20, 1.0f);
+
+	uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+	std::vector<uint32_t> threadCounts = { 1 };
+	for (uint32_t threads = 2; threads < hardwareThreads; threads *= 2)
+		threadCounts.push_back(threads);
+	if (hardwareThreads > 1)
+		threadCounts.push_back(hardwareThreads);
+
+	state.SetItemsPerIteration(values.size());
+	for (uint32_t threads : threadCounts)
+	{
+		JobSystem::Shutdown();
+		JobSystem::Init(threads);
+
+		state.Run(std::to_string(threads) + " threads", [&]()
+		{
+			JobSystem::ParallelFor((uint32_t)values.size(), 16384, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+					values[i] = std::sqrt(values[i] * values[i] + 1.0f);
+			});
+		});
+	}
+
+	JobSystem::Shutdown();
+	JobSystem::Init();
+}
+
+GLCORE_BENCHMARK(Jobs, RunWait)
+{
+	const uint32_t jobCount = 1000;
+	std::atomic<uint32_t> executed = 0;
+
+	state.SetItemsPerIteration(jobCount);
+	state.Run([&]()
+	{
+		JobCounter counter;
+		for (uint32_t i = 0; i < jobCount; i++)
+			JobSystem::Run([&]() { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+		JobSystem::Wait(counter);
+	});
+}
+
+// Caller-side cost of a formatted log call writing to a file, directly
+// and through the async sink. Messages go to a temporary file, not the console.
+GLCORE_BENCHMARK(Log, Throughput)
+{
+	std::string path = GetLogBenchmarkPath("glcore-benchmark-log.txt");
+	auto fileSink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(path, true);
+
+	auto syncLogger = std::make_shared<spdlog::logger>("SYNC", fileSink);
+	auto asyncSink = std::make_shared<AsyncLogSink>(std::vector<spdlog::sink_ptr>{ fileSink }, 8192, LogOverflowPolicy::Block);
+	auto asyncLogger = std::make_shared<spdlog::logger>("ASYNC", asyncSink);
+
+	uint32_t frame = 0;
+	state.SetItemsPerIteration(1);
+	state.Run("sync", [&]() { syncLogger->info("Frame {0} took {1:.3f} ms", frame++, 16.6f); });
+	state.Run("async", [&]() { asyncLogger->info("Frame {0} took {1:.3f} ms", frame++, 16.6f); });
+
+	const uint32_t producers = 4, messagesPerProducer = 10000;
+	state.SetItemsPerIteration(producers * messagesPerProducer);
+	state.Run("async 4 producers", [&]()
+	{
+		std::vector<std::thread> threads;
+		for (uint32_t i = 0; i < producers; i++)
+		{
+			threads.emplace_back([&asyncLogger, i]()
+			{
+				for (uint32_t message = 0; message < messagesPerProducer; message++)
+					asyncLogger->info("Producer {0} message {1}", i, message);
+			});
+		}
+		for (std::thread& thread : threads)
+			thread.join();
+	});
+
+	asyncSink->Stop();
+	fileSink->flush();
+	std::error_code error;
+	std::filesystem::remove(path, error);
+}
+
+// Distribution of single log calls; p99 and max show stalls on I/O or a
+// full queue that the mean hides
+GLCORE_BENCHMARK(Log, Latency)
+{
+	std::string path = GetLogBenchmarkPath("glcore-benchmark-latency.txt");
+	auto fileSink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(path, true);
+
+	auto syncLogger = std::make_shared<spdlog::logger>("SYNC", fileSink);
+	auto asyncSink = std::make_shared<AsyncLogSink>(std::vector<spdlog::sink_ptr>{ fileSink }, 8192, LogOverflowPolicy::Block);
+	auto asyncLogger = std::make_shared<spdlog::logger>("ASYNC", asyncSink);
+
+	uint32_t frame = 0;
+	state.SetIterationsPerSample(1);
+	state.SetSamples(std::max(state.GetSettings().Samples, 20000u));
+	state.Run("sync", [&]() { syncLogger->info("Frame {0} took {1:.3f} ms", frame++, 16.6f); });
+	state.Run("async", [&]() { asyncLogger->info("Frame {0} took {1:.3f} ms", frame++, 16.6f); });
+
+	asyncSink->Stop();
+	fileSink->flush();
+	std::error_code error;
+	std::filesystem::remove(path, error);
+}
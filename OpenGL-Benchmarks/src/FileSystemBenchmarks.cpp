@@ -0,0 +1,113 @@
+#include "GLCore.h"
+#include "GLCore/FileSystem/LZ4.h"
+
+#include "Benchmark.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace GLCore;
+
+namespace {
+
+	// Many small text files, like a shader and material directory
+	struct AssetDirectory
+	{
+		static constexpr uint32_t FileCount = 1000;
+
+		std::filesystem::path Root = std::filesystem::temp_directory_path() / "glcore-benchmark-assets";
+		std::string StoredArchive = Root.string() + "-stored.glpak";
+		std::string CompressedArchive = Root.string() + "-lz4.glpak";
+		std::vector<std::string> Paths;
+
+		AssetDirectory()
+		{
+			std::filesystem::create_directories(Root / "shaders");
+			for (uint32_t i = 0; i < FileCount; i++)
+			{
+				std::string path = "shaders/shader" + std::to_string(i) + ".glsl";
+				std::ofstream out(Root / path, std::ios::out | std::ios::trunc);
+				for (uint32_t line = 0; line < 64; line++)
+					out << "uniform vec4 u_Parameter" << line << "; // shader " << i << "\n";
+				Paths.push_back(path);
+			}
+
+			PackOptions options;
+			options.Compress = false;
+			PackDirectory(Root.string(), StoredArchive, options);
+			PackDirectory(Root.string(), CompressedArchive);
+		}
+
+		~AssetDirectory()
+		{
+			std::error_code error;
+			std::filesystem::remove_all(Root, error);
+			std::filesystem::remove(StoredArchive, error);
+			std::filesystem::remove(CompressedArchive, error);
+		}
+	};
+
+}
+
+// Reads every file of the directory through the VFS; loose reads cost an
+// open() and a mapping per file, archive reads a lookup in one mapping
+GLCORE_BENCHMARK(FileSystem, Read)
+{
+	AssetDirectory assets;
+	state.SetItemsPerIteration(AssetDirectory::FileCount);
+
+	auto readAll = [&]()
+	{
+		size_t bytes = 0;
+		FileData data;
+		for (const std::string& path : assets.Paths)
+		{
+			FileSystem::Read("bench/" + path, data);
+			bytes += data.GetSize();
+		}
+		Benchmarks::DoNotOptimize(bytes);
+	};
+
+	const std::pair<const char*, std::string> variants[] = {
+		{ "loose", assets.Root.string() },
+		{ "archive", assets.StoredArchive },
+		{ "archive lz4", assets.CompressedArchive }
+	};
+
+	for (const auto& [name, physicalPath] : variants)
+	{
+		if (!FileSystem::Mount("bench", physicalPath))
+		{
+			state.Skip("could not mount the generated assets");
+			return;
+		}
+		state.Run(name, readAll);
+		FileSystem::Unmount("bench");
+	}
+}
+
+GLCORE_BENCHMARK(FileSystem, LZ4)
+{
+	// Text-like data: repetitive but not trivially so
+	std::vector<uint8_t> data;
+	for (uint32_t i = 0; data.size() < (1 << 20); i++)
+	{
+		std::string line = "vec4 color" + std::to_string(i % 97) + " = texture(u_Texture, v_TexCoord * " + std::to_string(i) + ".0);\n";
+		data.insert(data.end(), line.begin(), line.end());
+	}
+
+	std::vector<uint8_t> compressed, decompressed(data.size());
+	LZ4::Compress(data.data(), data.size(), compressed);
+
+	state.SetItemsPerIteration(data.size());
+	state.Run("compress", [&]()
+	{
+		LZ4::Compress(data.data(), data.size(), compressed);
+		Benchmarks::DoNotOptimize(compressed.back());
+	});
+	state.Run("decompress", [&]()
+	{
+		LZ4::Decompress(compressed.data(), compressed.size(), decompressed.data(), decompressed.size());
+		Benchmarks::DoNotOptimize(decompressed.back());
+	});
+}
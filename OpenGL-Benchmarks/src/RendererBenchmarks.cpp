@@ -0,0 +1,219 @@
+#include "GLCore.h"
+#include "GLCoreUtils.h"
+
+#include "Benchmark.h"
+
+using namespace GLCore;
+using namespace GLCore::Utils;
+
+namespace {
+
+	const char* s_VertexSource = R"(#version 450 core
+
+layout (location = 0) in vec3 a_Position;
+
+uniform mat4 u_ViewProjection;
+uniform mat4 u_Transform;
+
+void main()
+{
+	gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0f);
+}
+)";
+
+	const char* s_FragmentSource = R"(#version 450 core
+
+layout (location = 0) out vec4 o_Color;
+
+uniform vec4 u_Color;
+
+void main()
+{
+	o_Color = u_Color;
+}
+)";
+
+	struct QuadMesh
+	{
+		GLuint VertexArray = 0, VertexBuffer = 0, IndexBuffer = 0;
+
+		QuadMesh()
+		{
+			float vertices[] = {
+				-0.5f, -0.5f, 0.0f,
+				 0.5f, -0.5f, 0.0f,
+				 0.5f,  0.5f, 0.0f,
+				-0.5f,  0.5f, 0.0f
+			};
+			uint32_t indices[] = { 0, 1, 2, 2, 3, 0 };
+
+			glCreateBuffers(1, &VertexBuffer);
+			glNamedBufferStorage(VertexBuffer, sizeof(vertices), vertices, 0);
+			glCreateBuffers(1, &IndexBuffer);
+			glNamedBufferStorage(IndexBuffer, sizeof(indices), indices, 0);
+
+			glCreateVertexArrays(1, &VertexArray);
+			glVertexArrayVertexBuffer(VertexArray, 0, VertexBuffer, 0, sizeof(float) * 3);
+			glVertexArrayElementBuffer(VertexArray, IndexBuffer);
+			glEnableVertexArrayAttrib(VertexArray, 0);
+			glVertexArrayAttribFormat(VertexArray, 0, 3, GL_FLOAT, GL_FALSE, 0);
+			glVertexArrayAttribBinding(VertexArray, 0, 0);
+		}
+
+		~QuadMesh()
+		{
+			glDeleteVertexArrays(1, &VertexArray);
+			glDeleteBuffers(1, &VertexBuffer);
+			glDeleteBuffers(1, &IndexBuffer);
+		}
+	};
+
+}
+
+// Drivers cache compiled programs by source, so every iteration compiles a
+// slightly different shader to measure real compile and link work
+GLCORE_GL_BENCHMARK(Shader, CompileLink)
+{
+	uint32_t counter = 0;
+	state.Run("vertex+fragment", [&]()
+	{
+		std::string vertexSource = std::string(s_VertexSource) + "// " + std::to_string(counter++) + "\n";
+		Shader* shader = Shader::FromGLSLSource(vertexSource, s_FragmentSource);
+		delete shader;
+	}, []() { glFinish(); });
+}
+
+// Items are bytes, so items_per_second is the upload bandwidth
+GLCORE_GL_BENCHMARK(Buffers, Upload)
+{
+	for (size_t size : { (size_t)64 << 10, (size_t)1 << 20, (size_t)16 << 20 })
+	{
+		std::vector<uint8_t> data(size, 0x5A);
+
+		GLuint buffer;
+		glCreateBuffers(1, &buffer);
+		glNamedBufferData(buffer, size, nullptr, GL_DYNAMIC_DRAW);
+
+		std::string sizeName = size >= (1 << 20) ? std::to_string(size >> 20) + " MiB" : std::to_string(size >> 10) + " KiB";
+
+		state.SetItemsPerIteration(size);
+		state.Run("SubData " + sizeName, [&]()
+		{
+			glNamedBufferSubData(buffer, 0, size, data.data());
+		}, []() { glFinish(); });
+
+		// Orphan then fill, as done for streaming data
+		state.Run("Orphan " + sizeName, [&]()
+		{
+			glNamedBufferData(buffer, size, nullptr, GL_DYNAMIC_DRAW);
+			glNamedBufferSubData(buffer, 0, size, data.data());
+		}, []() { glFinish(); });
+
+		glDeleteBuffers(1, &buffer);
+	}
+}
+
+// Records, sorts and executes a frame of quads through the RenderCommandQueue;
+// glFinish at the end of each sample includes the GPU time
+GLCORE_GL_BENCHMARK(Draw, Submit)
+{
+	const uint32_t drawCount = 10000, shaderCount = 4, textureCount = 8;
+
+	QuadMesh quad;
+
+	std::vector<Shader*> shaders;
+	for (uint32_t i = 0; i < shaderCount; i++)
+		shaders.push_back(Shader::FromGLSLSource(std::string(s_VertexSource) + "// " + std::to_string(i) + "\n", s_FragmentSource));
+
+	std::vector<GLuint> textures(textureCount);
+	glCreateTextures(GL_TEXTURE_2D, textureCount, textures.data());
+	for (GLuint texture : textures)
+	{
+		uint32_t white = 0xFFFFFFFF;
+		glTextureStorage2D(texture, 1, GL_RGBA8, 1, 1);
+		glTextureSubImage2D(texture, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &white);
+	}
+
+	// Interleave state so the sort has work to do
+	std::vector<DrawCommand> commands(drawCount);
+	for (uint32_t i = 0; i < drawCount; i++)
+	{
+		DrawCommand& command = commands[i];
+		command.Shader = shaders[i % shaderCount];
+		command.Texture = textures[(i / shaderCount) % textureCount];
+		command.VertexArray = quad.VertexArray;
+		command.IndexCount = 6;
+		command.Transform = glm::scale(glm::translate(glm::mat4(1.0f), { (float)(i % 100) * 0.02f - 1.0f, (float)(i / 100) * 0.02f - 1.0f, 0.0f }), glm::vec3(0.015f));
+		command.Color = { (float)(i % 7) / 7.0f, 0.5f, 1.0f, 1.0f };
+
+		float depth = (float)(drawCount - i) / (float)drawCount;
+		command.SortKey = MakeSortKey(command.Shader->GetRendererID(), command.Texture, depth);
+	}
+
+	glViewport(0, 0, 1280, 720);
+
+	RenderCommandQueue queue;
+	state.SetItemsPerIteration(drawCount);
+	state.Run("serial record", [&]()
+	{
+		queue.Clear();
+		for (const DrawCommand& command : commands)
+			queue.Submit(command);
+		queue.Execute();
+	}, []() { glFinish(); });
+
+	state.Run("parallel record", [&]()
+	{
+		queue.Clear();
+		JobSystem::ParallelFor(drawCount, 512, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+				queue.Submit(commands[i]);
+		});
+		queue.Execute();
+	}, []() { glFinish(); });
+
+	glDeleteTextures(textureCount, textures.data());
+	for (Shader* shader : shaders)
+		delete shader;
+}
+
+// Camera upload for a frame touching many programs: one glUniformMatrix4fv
+// per program against a single FrameUniformBuffer write
+GLCORE_GL_BENCHMARK(Uniforms, CameraUpload)
+{
+	const uint32_t programCount = 32;
+
+	std::vector<Shader*> shaders;
+	std::vector<GLint> locations;
+	for (uint32_t i = 0; i < programCount; i++)
+	{
+		shaders.push_back(Shader::FromGLSLSource(std::string(s_VertexSource) + "// " + std::to_string(i) + "\n", s_FragmentSource));
+		locations.push_back(glGetUniformLocation(shaders.back()->GetRendererID(), "u_ViewProjection"));
+	}
+
+	FrameData frame;
+	state.SetItemsPerIteration(programCount);
+	state.Run("per-program uniform", [&]()
+	{
+		frame.ViewProjection[3][0] += 0.001f;
+		for (uint32_t i = 0; i < programCount; i++)
+		{
+			glUseProgram(shaders[i]->GetRendererID());
+			glUniformMatrix4fv(locations[i], 1, GL_FALSE, glm::value_ptr(frame.ViewProjection));
+		}
+	}, []() { glFinish(); });
+
+	FrameUniformBuffer frameUniforms;
+	state.Run("frame uniform buffer", [&]()
+	{
+		frame.ViewProjection[3][0] += 0.001f;
+		frameUniforms.Update(frame);
+		for (uint32_t i = 0; i < programCount; i++)
+			glUseProgram(shaders[i]->GetRendererID());
+	}, []() { glFinish(); });
+
+	glUseProgram(0);
+	for (Shader* shader : shaders)
+		delete shader;
+}
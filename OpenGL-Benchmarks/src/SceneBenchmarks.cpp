@@ -0,0 +1,213 @@
+#include "GLCore.h"
+#include "GLCoreUtils.h"
+
+#include "Benchmark.h"
+
+using namespace GLCore;
+using namespace GLCore::Utils;
+
+GLCORE_BENCHMARK(Camera, SetPosition)
+{
+	OrthographicCamera camera(-1.6f, 1.6f, -0.9f, 0.9f);
+
+	float x = 0.0f;
+	state.Run([&]()
+	{
+		camera.SetPosition({ x, 0.5f, 0.0f });
+		x += 0.001f;
+		Benchmarks::DoNotOptimize(camera.GetViewProjectionMatrix());
+	});
+}
+
+// The common frame with no camera input
+GLCORE_BENCHMARK(Camera, ControllerUpdate)
+{
+	OrthographicCameraController controller(16.0f / 9.0f, true);
+
+	state.Run([&]()
+	{
+		controller.OnUpdate(0.016f);
+		Benchmarks::DoNotOptimize(controller.GetCamera().GetViewProjectionMatrix());
+	});
+}
+
+GLCORE_BENCHMARK(Camera, ScreenToWorld)
+{
+	OrthographicCamera camera(-1.6f, 1.6f, -0.9f, 0.9f);
+	camera.SetPosition({ 2.0f, 1.0f, 0.0f });
+	camera.SetRotation(30.0f);
+
+	float x = 0.0f;
+	state.Run([&]()
+	{
+		Benchmarks::DoNotOptimize(camera.ScreenToWorld({ x, 360.0f }, 1280.0f, 720.0f));
+		x = x < 1280.0f ? x + 1.0f : 0.0f;
+	});
+}
+
+GLCORE_BENCHMARK(Camera, PerspectiveOrbit)
+{
+	PerspectiveCamera camera(45.0f, 16.0f / 9.0f);
+
+	float yaw = 0.0f;
+	state.Run([&]()
+	{
+		camera.SetOrientation(yaw, -15.0f);
+		camera.SetPosition(-10.0f * camera.GetForwardDirection());
+		yaw += 0.1f;
+		Benchmarks::DoNotOptimize(camera.GetViewProjectionMatrix());
+	});
+}
+
+GLCORE_BENCHMARK(ECS, Integrate1M)
+{
+	const uint32_t entityCount = 1000000;
+
+	Registry registry;
+	registry.Reserve(entityCount);
+	for (uint32_t i = 0; i < entityCount; i++)
+	{
+		Entity entity = registry.Create();
+		registry.Emplace<TransformComponent>(entity).Position = { (float)(i % 1000), (float)(i / 1000), 0.0f };
+		registry.Emplace<VelocityComponent>(entity).Linear = { 1.0f, 0.5f, 0.0f };
+		// Every other entity is drawn, so the sprite pool drives the three-way view
+		if (i % 2 == 0)
+			registry.Emplace<SpriteRendererComponent>(entity);
+	}
+
+	const float ts = 0.016f;
+	state.SetItemsPerIteration(entityCount);
+	state.Run("Transform", [&]()
+	{
+		registry.View<TransformComponent>().Each([&](Entity, TransformComponent& transform)
+		{
+			transform.Rotation += 1.0f;
+		});
+	});
+
+	state.Run("Transform+Velocity", [&]()
+	{
+		registry.View<TransformComponent, VelocityComponent>().Each([&](Entity, TransformComponent& transform, VelocityComponent& velocity)
+		{
+			transform.Position += velocity.Linear * ts;
+			transform.Rotation += velocity.Angular * ts;
+		});
+	});
+
+	state.SetItemsPerIteration(entityCount / 2);
+	state.Run("Transform+Velocity+Sprite", [&]()
+	{
+		registry.View<TransformComponent, VelocityComponent, SpriteRendererComponent>().Each(
+			[&](Entity, TransformComponent& transform, VelocityComponent& velocity, SpriteRendererComponent& sprite)
+		{
+			transform.Position += velocity.Linear * ts;
+			sprite.Color.w = 1.0f;
+		});
+	});
+}
+
+GLCORE_BENCHMARK(SIMD, TransformPoints2D)
+{
+	const size_t count = 1 << 16;
+	std::vector<glm::vec2> points(count), transformed(count);
+	for (size_t i = 0; i < count; i++)
+		points[i] = { (float)i, (float)(count - i) };
+
+	glm::mat4 matrix = glm::rotate(glm::translate(glm::mat4(1.0f), { 1.0f, 2.0f, 0.0f }), 0.3f, { 0.0f, 0.0f, 1.0f });
+
+	SIMDLevel supported = GetSupportedSIMDLevel();
+	state.SetItemsPerIteration(count);
+	for (int level = (int)SIMDLevel::Scalar; level <= (int)supported; level++)
+	{
+		SetSIMDLevel((SIMDLevel)level);
+		state.Run(SIMDLevelToString((SIMDLevel)level), [&]()
+		{
+			TransformPoints2D(matrix, points.data(), transformed.data(), count);
+			Benchmarks::DoNotOptimize(transformed[count - 1]);
+		});
+	}
+	SetSIMDLevel(supported);
+}
+
+GLCORE_BENCHMARK(SIMD, BuildQuadCorners)
+{
+	const size_t count = 1 << 16;
+	std::vector<glm::vec2> positions(count), sizes(count, { 1.0f, 1.0f }), corners(count * 4);
+	std::vector<float> rotations(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		positions[i] = { (float)(i % 256), (float)(i / 256) };
+		rotations[i] = (float)(i % 360);
+	}
+
+	SIMDLevel supported = GetSupportedSIMDLevel();
+	state.SetItemsPerIteration(count);
+	for (int level = (int)SIMDLevel::Scalar; level <= (int)supported; level++)
+	{
+		SetSIMDLevel((SIMDLevel)level);
+		state.Run(SIMDLevelToString((SIMDLevel)level), [&]()
+		{
+			BuildQuadCorners(positions.data(), sizes.data(), rotations.data(), corners.data(), count);
+			Benchmarks::DoNotOptimize(corners[count * 4 - 1]);
+		});
+	}
+	SetSIMDLevel(supported);
+}
+
+// 100k nodes as a 4-ary tree (depth 9), the shape of a large scene graph
+GLCORE_BENCHMARK(Scene, TransformHierarchy100k)
+{
+	const uint32_t nodeCount = 100000;
+
+	TransformHierarchy hierarchy;
+	hierarchy.Reserve(nodeCount);
+	std::vector<TransformHierarchy::Node> nodes;
+	nodes.reserve(nodeCount);
+	for (uint32_t i = 0; i < nodeCount; i++)
+	{
+		LocalTransform local;
+		local.Position = { 1.0f, 0.0f, (float)(i % 4) };
+		local.Rotation = glm::angleAxis(glm::radians(10.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		nodes.push_back(hierarchy.Create(i == 0 ? TransformHierarchy::NullNode : nodes[(i - 1) / 4], local));
+	}
+	hierarchy.Update();
+
+	state.SetItemsPerIteration(nodeCount);
+
+	float angle = 0.0f;
+	auto rotated = [&](TransformHierarchy::Node node)
+	{
+		LocalTransform local = hierarchy.GetLocal(node);
+		local.Rotation = glm::angleAxis(angle += 0.001f, glm::vec3(0.0f, 1.0f, 0.0f));
+		return local;
+	};
+
+	state.Run("root changed", [&]()
+	{
+		hierarchy.SetLocal(nodes[0], rotated(nodes[0]));
+		hierarchy.Update();
+		Benchmarks::DoNotOptimize(hierarchy.GetWorldMatrix(nodes[nodeCount - 1]));
+	});
+
+	// A quarter of the tree hangs off the second root child
+	state.Run("subtree changed", [&]()
+	{
+		hierarchy.SetLocal(nodes[2], rotated(nodes[2]));
+		hierarchy.Update();
+		Benchmarks::DoNotOptimize(hierarchy.GetWorldMatrix(nodes[nodeCount - 1]));
+	});
+
+	state.Run("100 leaves changed", [&]()
+	{
+		for (uint32_t i = nodeCount - 1000; i < nodeCount; i += 10)
+			hierarchy.SetLocal(nodes[i], rotated(nodes[i]));
+		hierarchy.Update();
+		Benchmarks::DoNotOptimize(hierarchy.GetWorldMatrix(nodes[nodeCount - 1]));
+	});
+
+	state.Run("unchanged", [&]()
+	{
+		hierarchy.Update();
+		Benchmarks::DoNotOptimize(hierarchy.GetWorldMatrix(nodes[nodeCount - 1]));
+	});
+}
@@ -0,0 +1,111 @@
+#include "GLCore.h"
+#include "GLCoreUtils.h"
+
+#include "Benchmark.h"
+
+#include <filesystem>
+#include <memory>
+
+using namespace GLCore;
+using namespace GLCore::Utils;
+
+namespace {
+
+	// Dear ImGui ships a few TrueType fonts with its sources
+	const char* s_FontPath = "../OpenGL-Core/vendor/imgui/misc/fonts/Roboto-Medium.ttf";
+
+	struct CookedFont
+	{
+		std::string CookedPath = (std::filesystem::temp_directory_path() / "glcore-benchmark-font.glfont").string();
+		std::unique_ptr<Font> Loaded;
+
+		CookedFont()
+		{
+			if (std::filesystem::exists(s_FontPath) && CookFont(s_FontPath, CookedPath))
+				Loaded.reset(Font::FromCookedFile(CookedPath));
+		}
+
+		~CookedFont()
+		{
+			std::error_code error;
+			std::filesystem::remove(CookedPath, error);
+		}
+	};
+
+	// A HUD's worth of labels: short, mostly repeating from frame to frame
+	std::vector<std::string> MakeLabels(uint32_t count)
+	{
+		std::vector<std::string> labels;
+		for (uint32_t i = 0; i < count; i++)
+			labels.push_back("Entity " + std::to_string(i) + " - health " + std::to_string(100 - i % 100) + "%");
+		return labels;
+	}
+
+}
+
+// Shaping the same labels every frame against looking them up in the
+// TextRenderer's cache; items are labels
+GLCORE_GL_BENCHMARK(Text, Layout)
+{
+	CookedFont font;
+	if (!font.Loaded)
+	{
+		state.Skip("could not cook the ImGui font");
+		return;
+	}
+
+	std::vector<std::string> labels = MakeLabels(1000);
+	state.SetItemsPerIteration(labels.size());
+
+	TextLayout layout;
+	state.Run("uncached", [&]()
+	{
+		for (const std::string& label : labels)
+			font.Loaded->LayoutText(label, layout);
+		Benchmarks::DoNotOptimize(layout.Width);
+	});
+
+	TextRenderer renderer;
+	state.Run("cached", [&]()
+	{
+		float width = 0.0f;
+		for (const std::string& label : labels)
+			width += renderer.GetLayout(*font.Loaded, label).Width;
+		Benchmarks::DoNotOptimize(width);
+	});
+}
+
+// A frame of text through Begin/DrawString/End; glFinish at the end of each
+// sample includes the GPU time. Items are glyphs.
+GLCORE_GL_BENCHMARK(Text, Draw)
+{
+	CookedFont font;
+	if (!font.Loaded)
+	{
+		state.Skip("could not cook the ImGui font");
+		return;
+	}
+
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	std::vector<std::string> labels = MakeLabels(2000);
+	TextRenderer renderer;
+
+	auto drawFrame = [&]()
+	{
+		renderer.Begin(glm::mat4(1.0f));
+		for (uint32_t i = 0; i < (uint32_t)labels.size(); i++)
+		{
+			glm::vec3 position = { (float)(i % 4) * 0.5f - 1.0f, 1.0f - (float)(i / 4) * 0.004f, 0.0f };
+			renderer.DrawString(*font.Loaded, labels[i], position, 0.02f, { 1.0f, 1.0f, 1.0f, 1.0f });
+		}
+		renderer.End();
+	};
+
+	drawFrame();
+	state.SetItemsPerIteration(renderer.GetStats().Glyphs);
+	state.Run("2000 labels", drawFrame, []() { glFinish(); });
+
+	glDisable(GL_BLEND);
+}
@@ -0,0 +1,9 @@
+// Compiled without the glad, glm, GLFW and ImGui include directories to keep
+// GLCORE_LEAN_HEADERS honest; see the GLCoreLeanHeaders target
+
+#define GLCORE_LEAN_HEADERS
+#include "GLCore.h"
+
+#if defined(__glad_h_) || defined(GLM_VERSION) || defined(_glfw3_h_) || defined(IMGUI_VERSION)
+	#error "GLCore.h pulled in a third-party header under GLCORE_LEAN_HEADERS"
+#endif
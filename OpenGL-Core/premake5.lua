@@ -22,7 +22,8 @@ project "OpenGL-Core"
 
 	defines
 	{
-		"_CRT_SECURE_NO_WARNINGS"
+		"_CRT_SECURE_NO_WARNINGS",
+		"SPDLOG_COMPILED_LIB"
 	}
 
 	includedirs
@@ -40,8 +41,7 @@ project "OpenGL-Core"
 	{ 
 		"GLFW",
 		"Glad",
-		"ImGui",
-		"opengl32.lib"
+		"ImGui"
 	}
 
 	filter "system:windows"
@@ -53,6 +53,28 @@ project "OpenGL-Core"
 			"GLFW_INCLUDE_NONE"
 		}
 
+		links
+		{
+			"opengl32.lib"
+		}
+
+		removefiles
+		{
+			"src/Platform/Linux/**"
+		}
+
+	filter "system:linux"
+		defines
+		{
+			"GLCORE_PLATFORM_LINUX",
+			"GLFW_INCLUDE_NONE"
+		}
+
+		removefiles
+		{
+			"src/Platform/Windows/**"
+		}
+
 	filter "configurations:Debug"
 		defines "GLCORE_DEBUG"
 		runtime "Debug"
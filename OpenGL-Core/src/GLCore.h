@@ -1,11 +1,35 @@
 #pragma once
 
-// Main header file - include into application for complete access
+// Main header file - include into application for complete access.
+// Define GLCORE_LEAN_HEADERS to skip glad, glm, ImGui and every GLCore header
+// that pulls them in, and include what you use instead; GLCoreFwd.h has
+// forward declarations.
 
-#include <glad/glad.h>
-#include <glm/glm.hpp>
-#include <glm/gtc/type_ptr.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-#include <imgui.h>
+#ifndef GLCORE_LEAN_HEADERS
+	#include <glad/glad.h>
+	#include <glm/glm.hpp>
+	#include <glm/gtc/type_ptr.hpp>
+	#include <glm/gtc/matrix_transform.hpp>
+	#include <imgui.h>
+#endif
 
-#include "GLCore/Core/Application.h"
\ No newline at end of file
+#include "GLCoreFwd.h"
+
+#include "GLCore/Core/Log.h"
+#include "GLCore/Core/Profile.h"
+#include "GLCore/Core/Application.h"
+#include "GLCore/ImGui/ImGuiLayer.h"
+#include "GLCore/Core/JobSystem.h"
+#include "GLCore/Core/MappedFile.h"
+#include "GLCore/FileSystem/FileSystem.h"
+#include "GLCore/FileSystem/PackedArchive.h"
+#include "GLCore/Asset/AssetManager.h"
+#include "GLCore/Scene/Registry.h"
+
+#ifndef GLCORE_LEAN_HEADERS
+	#include "GLCore/Renderer/RenderCommandQueue.h"
+	#include "GLCore/Renderer/FrameUniformBuffer.h"
+	#include "GLCore/Renderer/TextRenderer.h"
+	#include "GLCore/Scene/Components.h"
+	#include "GLCore/Scene/TransformHierarchy.h"
+#endif
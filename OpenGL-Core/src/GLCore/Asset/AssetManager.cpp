@@ -0,0 +1,410 @@
+#include "glpch.h"
+#include "AssetManager.h"
+
+#include "GLCore/FileSystem/FileSystem.h"
+#include "GLCore/Util/Font.h"
+#include "GLCore/Util/FontCooker.h"
+#include "GLCore/Util/Mesh.h"
+#include "GLCore/Util/MeshCooker.h"
+#include "GLCore/Util/Shader.h"
+#include "GLCore/Util/Texture.h"
+
+#include <chrono>
+#include <limits>
+
+namespace GLCore {
+
+	namespace Internal {
+
+		// Decoded data on its way from a worker to the GL thread
+		struct AssetPayload
+		{
+			uint8_t* Pixels = nullptr;
+			uint32_t Width = 0, Height = 0;
+
+			std::string VertexSource, FragmentSource;
+
+			FileData CookedFile; // Meshes and fonts
+
+			~AssetPayload()
+			{
+				if (Pixels)
+					Utils::FreeImagePixels(Pixels);
+			}
+		};
+
+		AssetSlot::AssetSlot(AssetType type, const std::string& path)
+			: Type(type), Path(path) {}
+
+		AssetSlot::~AssetSlot() = default;
+
+	}
+
+	using Internal::AssetSlot;
+	using Internal::AssetPayload;
+
+	namespace {
+
+		const char* AssetTypeName(AssetType type)
+		{
+			switch (type)
+			{
+				case AssetType::Texture: return "texture";
+				case AssetType::Shader:  return "shader";
+				case AssetType::Mesh:    return "mesh";
+				case AssetType::Font:    return "font";
+			}
+			return "asset";
+		}
+
+		std::string MakeKey(AssetType type, const std::string& path)
+		{
+			return std::string(1, (char)('0' + (int)type)) + ':' + path;
+		}
+
+	}
+
+	AssetManager::~AssetManager()
+	{
+		Shutdown();
+	}
+
+	void AssetManager::Shutdown()
+	{
+		if (JobSystem::IsInitialized())
+			JobSystem::Wait(m_DecodeJobs);
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		for (auto& [key, slot] : m_Assets)
+		{
+			if (slot->RefCount.load() > 0)
+				LOG_WARN("Asset '{0}' is still referenced at shutdown", slot->Path);
+			DestroyObject(slot.get());
+		}
+
+		m_UploadQueue.clear();
+		m_Cache.clear();
+		m_Assets.clear();
+		m_MemoryUsage = 0;
+		m_Loading = 0;
+	}
+
+	AssetSlot* AssetManager::Acquire(AssetType type, const std::string& path)
+	{
+		// "a/./b/../c.png" and "a/c.png" are the same asset
+		std::string normalizedPath = FileSystem::NormalizePath(path);
+		std::string key = MakeKey(type, normalizedPath);
+
+		AssetSlot* slot = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			auto it = m_Assets.find(key);
+			if (it != m_Assets.end())
+			{
+				slot = it->second.get();
+				slot->RefCount.fetch_add(1, std::memory_order_relaxed);
+				if (slot->Cached)
+				{
+					m_Cache.erase(slot->CachePosition);
+					slot->Cached = false;
+				}
+				return slot;
+			}
+
+			auto newSlot = std::make_unique<AssetSlot>(type, normalizedPath);
+			newSlot->RefCount = 1;
+			newSlot->ReleaseFlag = &m_ReleasePending;
+			slot = newSlot.get();
+			m_Assets.emplace(std::move(key), std::move(newSlot));
+			m_Loading++;
+		}
+
+		// The main thread only runs jobs while it waits, so without workers
+		// the job would sit in the queue
+		if (JobSystem::IsInitialized() && JobSystem::GetThreadCount() > 1)
+			JobSystem::Run([this, slot]() { Decode(slot); }, &m_DecodeJobs);
+		else
+			Decode(slot);
+
+		return slot;
+	}
+
+	void AssetManager::Decode(AssetSlot* slot)
+	{
+		auto payload = std::make_unique<AssetPayload>();
+		bool success = false;
+
+		switch (slot->Type)
+		{
+			case AssetType::Texture:
+			{
+				payload->Pixels = Utils::DecodeImageFile(slot->Path, payload->Width, payload->Height);
+				success = payload->Pixels != nullptr;
+				break;
+			}
+			case AssetType::Shader:
+			{
+				success = FileSystem::ReadText(slot->Path + ".vert.glsl", payload->VertexSource)
+					&& FileSystem::ReadText(slot->Path + ".frag.glsl", payload->FragmentSource);
+				break;
+			}
+			case AssetType::Mesh:
+			{
+				std::string cookedPath;
+				if (!Utils::EnsureCookedMesh(slot->Path, cookedPath) || !FileSystem::Read(cookedPath, payload->CookedFile))
+					break;
+
+				const uint8_t* data = payload->CookedFile.GetData();
+				size_t size = payload->CookedFile.GetSize();
+				if (!Utils::ValidateCookedMesh(data, size))
+				{
+					LOG_ERROR("'{0}' is not a valid version {1} cooked mesh", cookedPath, Utils::CookedMeshHeader::CurrentVersion);
+					break;
+				}
+
+				// Fault the pages in here rather than during the upload
+				volatile uint8_t sink = 0;
+				for (size_t offset = 0; offset < size; offset += 4096)
+					sink = sink + data[offset];
+				success = true;
+				break;
+			}
+			case AssetType::Font:
+			{
+				std::string cookedPath;
+				if (!Utils::EnsureCookedFont(slot->Path, cookedPath) || !FileSystem::Read(cookedPath, payload->CookedFile))
+					break;
+
+				if (!Utils::ValidateCookedFont(payload->CookedFile.GetData(), payload->CookedFile.GetSize()))
+				{
+					LOG_ERROR("'{0}' is not a valid version {1} cooked font", cookedPath, Utils::CookedFontHeader::CurrentVersion);
+					break;
+				}
+				success = true;
+				break;
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (success)
+			{
+				slot->Payload = std::move(payload);
+				slot->State.store(AssetState::Uploading, std::memory_order_release);
+				m_UploadQueue.push_back(slot);
+			}
+			else
+			{
+				LOG_ERROR("Could not load {0} '{1}'", AssetTypeName(slot->Type), slot->Path);
+				slot->State.store(AssetState::Failed, std::memory_order_release);
+				m_Loading--;
+				m_ReleasePending = true;
+			}
+		}
+
+		if (success && m_UploadReadyCallback)
+			m_UploadReadyCallback();
+	}
+
+	void AssetManager::Upload(AssetSlot* slot)
+	{
+		AssetPayload& payload = *slot->Payload;
+		void* object = nullptr;
+		size_t memorySize = 0;
+
+		switch (slot->Type)
+		{
+			case AssetType::Texture:
+			{
+				Utils::Texture2D* texture = Utils::Texture2D::FromPixels(payload.Width, payload.Height, payload.Pixels);
+				object = texture;
+				memorySize = texture ? texture->GetMemorySize() : 0;
+				break;
+			}
+			case AssetType::Shader:
+			{
+				object = Utils::Shader::FromGLSLSource(payload.VertexSource, payload.FragmentSource);
+				memorySize = payload.VertexSource.size() + payload.FragmentSource.size();
+				break;
+			}
+			case AssetType::Mesh:
+			{
+				// Decode() validated it
+				Utils::Mesh* mesh = Utils::Mesh::FromValidatedCookedMemory(payload.CookedFile.GetData());
+				object = mesh;
+				memorySize = mesh ? mesh->GetMemorySize() : 0;
+				break;
+			}
+			case AssetType::Font:
+			{
+				Utils::Font* font = Utils::Font::FromCookedMemory(payload.CookedFile.GetData(), payload.CookedFile.GetSize(), slot->Path);
+				object = font;
+				memorySize = font ? font->GetMemorySize() : 0;
+				break;
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		slot->Payload.reset();
+		slot->Object = object;
+		slot->MemorySize = memorySize;
+		m_MemoryUsage += memorySize;
+		m_Loading--;
+
+		if (object)
+		{
+			slot->State.store(AssetState::Ready, std::memory_order_release);
+		}
+		else
+		{
+			LOG_ERROR("Could not upload {0} '{1}'", AssetTypeName(slot->Type), slot->Path);
+			slot->State.store(AssetState::Failed, std::memory_order_release);
+		}
+
+		// Released while it was loading
+		if (slot->RefCount.load(std::memory_order_acquire) == 0)
+			m_ReleasePending = true;
+	}
+
+	void AssetManager::ProcessUploads(float budget)
+	{
+		using Clock = std::chrono::steady_clock;
+		Clock::time_point start = Clock::now();
+		uint32_t uploads = 0;
+
+		// At least one upload per call, so a single large asset cannot stall
+		// the queue behind a small budget
+		while (true)
+		{
+			AssetSlot* slot = nullptr;
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				if (m_UploadQueue.empty())
+					break;
+				slot = m_UploadQueue.front();
+				m_UploadQueue.pop_front();
+			}
+
+			Upload(slot);
+			uploads++;
+
+			if (std::chrono::duration<float, std::milli>(Clock::now() - start).count() >= budget)
+				break;
+		}
+
+		m_UploadsLastUpdate = uploads;
+		m_UploadTimeLastUpdate = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+	}
+
+	void AssetManager::Update()
+	{
+		ProcessUploads(m_UploadBudget);
+
+		if (m_ReleasePending.exchange(false, std::memory_order_acquire))
+			UpdateCache();
+
+		Evict(m_MemoryBudget);
+	}
+
+	void AssetManager::WaitForAll()
+	{
+		while (m_Loading.load() > 0)
+		{
+			if (JobSystem::IsInitialized())
+				JobSystem::Wait(m_DecodeJobs);
+			ProcessUploads(std::numeric_limits<float>::max());
+		}
+
+		if (m_ReleasePending.exchange(false, std::memory_order_acquire))
+			UpdateCache();
+		Evict(m_MemoryBudget);
+	}
+
+	void AssetManager::CollectGarbage()
+	{
+		m_ReleasePending = false;
+		UpdateCache();
+		Evict(0);
+	}
+
+	void AssetManager::UpdateCache()
+	{
+		// A count of zero cannot rise again without the mutex: Acquire() holds
+		// it and copying a handle needs a live reference
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		for (auto it = m_Assets.begin(); it != m_Assets.end();)
+		{
+			AssetSlot* slot = it->second.get();
+			if (slot->Cached || slot->RefCount.load(std::memory_order_acquire) > 0)
+			{
+				++it;
+				continue;
+			}
+
+			AssetState state = slot->State.load(std::memory_order_acquire);
+			if (state == AssetState::Ready)
+			{
+				m_Cache.push_front(slot);
+				slot->CachePosition = m_Cache.begin();
+				slot->Cached = true;
+			}
+			else if (state == AssetState::Failed)
+			{
+				// Forget failures so a later Load() tries again
+				it = m_Assets.erase(it);
+				continue;
+			}
+			++it;
+		}
+	}
+
+	void AssetManager::Evict(size_t memoryBudget)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		while (m_MemoryUsage > memoryBudget && !m_Cache.empty())
+		{
+			AssetSlot* slot = m_Cache.back();
+			m_Cache.pop_back();
+
+			m_MemoryUsage -= slot->MemorySize;
+			m_Evictions++;
+			DestroyObject(slot);
+			m_Assets.erase(MakeKey(slot->Type, slot->Path));
+		}
+	}
+
+	void AssetManager::DestroyObject(AssetSlot* slot)
+	{
+		switch (slot->Type)
+		{
+			case AssetType::Texture: delete static_cast<Utils::Texture2D*>(slot->Object); break;
+			case AssetType::Shader:  delete static_cast<Utils::Shader*>(slot->Object); break;
+			case AssetType::Mesh:    delete static_cast<Utils::Mesh*>(slot->Object); break;
+			case AssetType::Font:    delete static_cast<Utils::Font*>(slot->Object); break;
+		}
+		slot->Object = nullptr;
+	}
+
+	AssetManagerStats AssetManager::GetStats() const
+	{
+		AssetManagerStats stats;
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		for (const auto& [key, slot] : m_Assets)
+		{
+			AssetState state = slot->State.load(std::memory_order_relaxed);
+			if (state == AssetState::Ready)
+				stats.Resident++;
+			else if (state == AssetState::Loading || state == AssetState::Uploading)
+				stats.Loading++;
+		}
+		stats.Cached = (uint32_t)m_Cache.size();
+		stats.MemoryUsage = m_MemoryUsage;
+		stats.MemoryBudget = m_MemoryBudget;
+		stats.UploadsLastUpdate = m_UploadsLastUpdate;
+		stats.UploadTimeLastUpdate = m_UploadTimeLastUpdate;
+		stats.Evictions = m_Evictions;
+		return stats;
+	}
+
+}
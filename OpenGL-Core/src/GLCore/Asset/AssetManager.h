@@ -0,0 +1,228 @@
+#pragma once
+
+#include "GLCore/Core/Core.h"
+#include "GLCore/Core/JobSystem.h"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace GLCore {
+
+	namespace Utils {
+		class Texture2D;
+		class Shader;
+		class Mesh;
+		class Font;
+	}
+
+	enum class AssetType : uint8_t
+	{
+		Texture = 0, Shader, Mesh, Font
+	};
+
+	enum class AssetState : uint8_t
+	{
+		None = 0,  // Empty handle
+		Loading,   // Queued or being read and decoded on a worker
+		Uploading, // Decoded, waiting for its GL upload
+		Ready,
+		Failed
+	};
+
+	template<typename T> struct AssetTraits;
+	template<> struct AssetTraits<Utils::Texture2D> { static constexpr AssetType Type = AssetType::Texture; };
+	template<> struct AssetTraits<Utils::Shader> { static constexpr AssetType Type = AssetType::Shader; };
+	template<> struct AssetTraits<Utils::Mesh> { static constexpr AssetType Type = AssetType::Mesh; };
+	template<> struct AssetTraits<Utils::Font> { static constexpr AssetType Type = AssetType::Font; };
+
+	namespace Internal {
+
+		struct AssetPayload;
+
+		struct AssetSlot
+		{
+			AssetType Type;
+			std::string Path;
+
+			std::atomic<uint32_t> RefCount = 0;
+			std::atomic<AssetState> State = AssetState::Loading;
+			std::atomic<bool>* ReleaseFlag = nullptr;
+
+			// Written before State becomes Ready
+			void* Object = nullptr;
+			size_t MemorySize = 0;
+
+			// Owned by the manager, under its mutex
+			std::unique_ptr<AssetPayload> Payload;
+			bool Cached = false;
+			std::list<AssetSlot*>::iterator CachePosition;
+
+			AssetSlot(AssetType type, const std::string& path);
+			~AssetSlot();
+		};
+
+	}
+
+	// Reference-counted handle to an asset of type T. Copies share the
+	// asset; once the last handle is gone the asset stays resident in the
+	// manager's LRU cache until the memory budget forces it out. Handles are
+	// cheap to copy on any thread but must not outlive the AssetManager.
+	template<typename T>
+	class AssetHandle
+	{
+	public:
+		AssetHandle() = default;
+		AssetHandle(const AssetHandle& other)
+			: m_Slot(other.m_Slot)
+		{
+			if (m_Slot)
+				m_Slot->RefCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		AssetHandle(AssetHandle&& other) noexcept
+			: m_Slot(other.m_Slot)
+		{
+			other.m_Slot = nullptr;
+		}
+		~AssetHandle() { Reset(); }
+
+		AssetHandle& operator=(AssetHandle other) noexcept
+		{
+			std::swap(m_Slot, other.m_Slot);
+			return *this;
+		}
+
+		void Reset()
+		{
+			if (!m_Slot)
+				return;
+
+			// The slot may be freed as soon as the count hits zero
+			std::atomic<bool>* releaseFlag = m_Slot->ReleaseFlag;
+			if (m_Slot->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				releaseFlag->store(true, std::memory_order_release);
+			m_Slot = nullptr;
+		}
+
+		AssetState GetState() const { return m_Slot ? m_Slot->State.load(std::memory_order_acquire) : AssetState::None; }
+		bool IsReady() const { return GetState() == AssetState::Ready; }
+		bool IsFailed() const { return GetState() == AssetState::Failed; }
+
+		// nullptr until the asset is ready
+		T* Get() const { return IsReady() ? static_cast<T*>(m_Slot->Object) : nullptr; }
+		T* operator->() const
+		{
+			GLCORE_ASSERT(IsReady(), "Asset is not loaded yet!");
+			return Get();
+		}
+
+		const std::string& GetPath() const
+		{
+			static const std::string s_Empty;
+			return m_Slot ? m_Slot->Path : s_Empty;
+		}
+
+		explicit operator bool() const { return m_Slot != nullptr; }
+		bool operator==(const AssetHandle& other) const { return m_Slot == other.m_Slot; }
+		bool operator!=(const AssetHandle& other) const { return m_Slot != other.m_Slot; }
+	private:
+		friend class AssetManager;
+
+		// Adopts a reference already taken by the manager
+		explicit AssetHandle(Internal::AssetSlot* slot)
+			: m_Slot(slot) {}
+	private:
+		Internal::AssetSlot* m_Slot = nullptr;
+	};
+
+	struct AssetManagerStats
+	{
+		uint32_t Resident = 0;    // Ready assets, referenced or cached
+		uint32_t Cached = 0;      // Ready but unreferenced, evictable
+		uint32_t Loading = 0;     // Still on a worker or waiting to upload
+		size_t MemoryUsage = 0;   // Approximate GPU memory of resident assets
+		size_t MemoryBudget = 0;
+		uint32_t UploadsLastUpdate = 0;
+		float UploadTimeLastUpdate = 0.0f; // Milliseconds
+		uint64_t Evictions = 0;
+	};
+
+	// Loads textures, shaders, meshes and fonts asynchronously. Load() returns at
+	// once; file I/O and decoding run on the JobSystem, GL objects are
+	// created in Update() on the context thread, a few per frame within the
+	// upload time budget. The same type and path always share one asset.
+	//
+	// Paths go through FileSystem: textures are image files, meshes are .obj
+	// sources or cooked .glmesh files (see Utils::Mesh::FromFile), fonts are
+	// .ttf/.otf sources cooked the same way, and shaders are a common prefix,
+	// so "assets/shaders/test" loads test.vert.glsl and test.frag.glsl.
+	class AssetManager
+	{
+	public:
+		AssetManager() = default;
+		~AssetManager();
+
+		AssetManager(const AssetManager&) = delete;
+		AssetManager& operator=(const AssetManager&) = delete;
+
+		// Any thread
+		template<typename T>
+		AssetHandle<T> Load(const std::string& path)
+		{
+			return AssetHandle<T>(Acquire(AssetTraits<T>::Type, path));
+		}
+
+		// GL context thread, once per frame: uploads decoded assets, then
+		// evicts unreferenced ones while over the memory budget
+		void Update();
+		// GL context thread: Update() without an upload budget until nothing
+		// is loading
+		void WaitForAll();
+		// GL context thread: evicts every unreferenced asset
+		void CollectGarbage();
+		// GL context thread, before JobSystem::Shutdown(): waits for decode
+		// jobs and destroys every asset. No handles may be used afterwards.
+		void Shutdown();
+
+		// Runs on the decoding thread when an asset is ready for Update(), so
+		// a loop that sleeps between frames can wake up
+		void SetUploadReadyCallback(std::function<void()> callback) { m_UploadReadyCallback = std::move(callback); }
+
+		void SetUploadBudget(float milliseconds) { m_UploadBudget = milliseconds; }
+		float GetUploadBudget() const { return m_UploadBudget; }
+		void SetMemoryBudget(size_t bytes) { m_MemoryBudget = bytes; }
+		size_t GetMemoryBudget() const { return m_MemoryBudget; }
+
+		AssetManagerStats GetStats() const;
+	private:
+		Internal::AssetSlot* Acquire(AssetType type, const std::string& path);
+		void Decode(Internal::AssetSlot* slot);
+		void Upload(Internal::AssetSlot* slot);
+		void ProcessUploads(float budget);
+		void UpdateCache();
+		void Evict(size_t memoryBudget);
+		static void DestroyObject(Internal::AssetSlot* slot);
+	private:
+		mutable std::mutex m_Mutex;
+		std::unordered_map<std::string, std::unique_ptr<Internal::AssetSlot>> m_Assets;
+		std::deque<Internal::AssetSlot*> m_UploadQueue;
+		std::list<Internal::AssetSlot*> m_Cache; // Most recently released first
+		std::atomic<bool> m_ReleasePending = false;
+		std::atomic<uint32_t> m_Loading = 0;
+		JobCounter m_DecodeJobs;
+		std::function<void()> m_UploadReadyCallback;
+
+		float m_UploadBudget = 2.0f;
+		size_t m_MemoryBudget = (size_t)256 << 20;
+		size_t m_MemoryUsage = 0;
+
+		uint32_t m_UploadsLastUpdate = 0;
+		float m_UploadTimeLastUpdate = 0.0f;
+		uint64_t m_Evictions = 0;
+	};
+
+}
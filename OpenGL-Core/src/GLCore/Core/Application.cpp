@@ -4,8 +4,16 @@
 #include "Log.h"
 
 #include "Input.h"
+#include "JobSystem.h"
+#include "Profile.h"
 
-#include <glfw/glfw3.h>
+#include "GLCore/ImGui/ImGuiLayer.h"
+#include "GLCore/Util/Framebuffer.h"
+#include "GLCore/Util/OpenGLDebug.h"
+
+#include <GLFW/glfw3.h>
+
+#include <cstdlib>
 
 namespace GLCore {
 
@@ -19,61 +27,294 @@ namespace GLCore {
 		{
 			// Initialize core
 			Log::Init();
+			JobSystem::Init();
+			GLCORE_PROFILE_BEGIN_SESSION("GLCore-Profile.json");
 		}
 
 		GLCORE_ASSERT(!s_Instance, "Application already exists!");
 		s_Instance = this;
 
 		m_Window = std::unique_ptr<Window>(Window::Create({ name, width, height }));
+		if (!m_Window)
+		{
+			LOG_CRITICAL("Could not create the application window, exiting");
+			std::abort();
+		}
 		m_Window->SetEventCallback(BIND_EVENT_FN(OnEvent));
 
 		// Renderer::Init();
 
 		m_ImGuiLayer = new ImGuiLayer();
 		PushOverlay(m_ImGuiLayer);
+
+		// Uploads happen in the frame loop, which may be asleep
+		m_AssetManager.SetUploadReadyCallback([this]() { RequestRedraw(); });
+	}
+
+	Application::~Application()
+	{
+		// Layers drop their asset handles and the assets go while the context,
+		// the job system and the logger are still up
+		m_LayerStack.Clear();
+		m_AssetManager.Shutdown();
+
+		JobSystem::Shutdown();
+		GLCORE_PROFILE_END_SESSION();
+		Log::Shutdown();
+	}
+
+	void Application::PushLayer(Layer* layer, int32_t priority)
+	{
+		m_LayerStack.PushLayer(std::unique_ptr<Layer>(layer), priority);
+	}
+
+	void Application::PushOverlay(Layer* layer, int32_t priority)
+	{
+		m_LayerStack.PushOverlay(std::unique_ptr<Layer>(layer), priority);
+	}
+
+	void Application::EnablePipelinedRendering(uint32_t maxFrameLatency)
+	{
+		GLCORE_ASSERT(!m_RenderThread.IsRunning(), "Pipelined rendering must be enabled before Run()!");
+		m_PipelinedRendering = true;
+		m_MaxFrameLatency = maxFrameLatency;
+	}
+
+	void Application::SubmitRenderCommand(RenderThread::RenderFunction function)
+	{
+		if (m_RenderThread.IsRunning())
+			m_RenderThread.Submit(std::move(function));
+		else
+			function();
+	}
+
+	float Application::GetInputLatency() const
+	{
+		return m_PipelinedRendering ? m_RenderThread.GetInputLatency() : m_InputLatency;
+	}
+
+	float Application::GetAverageInputLatency() const
+	{
+		return m_PipelinedRendering ? m_RenderThread.GetAverageInputLatency() : m_AverageInputLatency;
+	}
+
+	void Application::EnableDynamicResolution(const DynamicResolutionSpecification& specification)
+	{
+		GLCORE_ASSERT(!m_RenderThread.IsRunning(), "Dynamic resolution must be enabled before Run()!");
+		m_DynamicResolution = DynamicResolution(specification);
+		m_DynamicResolutionEnabled = true;
+		m_RenderScale = m_DynamicResolution.GetScale();
+	}
+
+	void Application::BeginScene(uint32_t width, uint32_t height)
+	{
+		if (!m_SceneFramebuffer)
+		{
+			Utils::FramebufferSpecification specification;
+			specification.Width = width;
+			specification.Height = height;
+			specification.Samples = m_DynamicResolution.GetSpecification().Samples;
+			specification.RenderScale = m_DynamicResolution.GetScale();
+			m_SceneFramebuffer = std::make_unique<Utils::Framebuffer>(specification);
+		}
+
+		m_SceneFramebuffer->Resize(width, height);
+		m_SceneFramebuffer->Bind();
+		m_SceneTimer.Begin();
+	}
+
+	void Application::EndScene(uint32_t width, uint32_t height)
+	{
+		m_SceneTimer.End();
+
+		m_SceneFramebuffer->BlitTo(0, width, height);
+		m_SceneFramebuffer->Unbind();
+		// Bind() shrank the viewport to the render size
+		glViewport(0, 0, width, height);
+
+		// Results lag a few frames behind, which also damps the controller
+		if (m_SceneTimer.Poll())
+		{
+			float scale = m_DynamicResolution.Update(m_SceneTimer.GetElapsedTime());
+			m_SceneFramebuffer->SetRenderScale(scale);
+			m_RenderScale.store(scale, std::memory_order_relaxed);
+			m_SceneGPUTime.store(m_SceneTimer.GetElapsedTime(), std::memory_order_relaxed);
+		}
+	}
+
+	void Application::SetRunMode(RunMode mode, double maxIdleTime)
+	{
+		m_MaxIdleTime = maxIdleTime;
+		m_RunMode.store(mode, std::memory_order_relaxed);
+		RequestRedraw();
+	}
+
+	void Application::RequestRedraw()
+	{
+		m_RedrawRequested = true;
+		if (m_RunMode.load(std::memory_order_relaxed) == RunMode::Reactive)
+			m_Window->PostEmptyEvent();
+	}
+
+	bool Application::NeedsRedraw() const
+	{
+		return m_RedrawRequested.load() || m_ActiveAnimations.load() > 0 || Input::IsAnyKeyOrButtonHeld() || m_ImGuiLayer->IsActive();
+	}
+
+	bool Application::WaitForRedraw()
+	{
+		if (NeedsRedraw())
+			return true;
+
+		double timeout = 0.0;
+		if (m_MaxIdleTime > 0.0)
+		{
+			timeout = m_LastRenderTime + m_MaxIdleTime - glfwGetTime();
+			if (timeout <= 0.0)
+				return true;
+		}
+
+		// Events are dispatched to OnEvent from inside the wait
+		m_Window->WaitEvents(timeout);
+		return NeedsRedraw() || (m_MaxIdleTime > 0.0 && glfwGetTime() - m_LastRenderTime >= m_MaxIdleTime);
 	}
 
-	void Application::PushLayer(Layer* layer)
+	void Application::StartEventRecording(const std::string& filepath)
 	{
-		m_LayerStack.PushLayer(layer);
+		m_EventRecorder.Open(filepath);
 	}
 
-	void Application::PushOverlay(Layer* layer)
+	void Application::StopEventRecording()
 	{
-		m_LayerStack.PushOverlay(layer);
+		m_EventRecorder.Close();
+	}
+
+	bool Application::StartEventReplay(const EventReplaySpecification& specification)
+	{
+		if (!m_EventReplay.Load(specification.Filepath))
+			return false;
+
+		LOG_INFO("Replaying {0} frames from '{1}'", m_EventReplay.GetFrameCount(), specification.Filepath);
+		m_ReplaySpecification = specification;
+		m_ReplayingEvents = true;
+		m_ReplayFrame = 0;
+		m_ReplayFrameTimes.clear();
+		m_ReplayFrameTimes.reserve(m_EventReplay.GetFrameCount());
+		Input::Reset();
+		return true;
 	}
 
 	void Application::OnEvent(Event& e)
 	{
+		if (m_ReplayingEvents && !m_DispatchingReplayEvent && e.IsInCategory(EventCategoryInput))
+			return;
+
+		if (m_EventRecorder.IsRecording())
+			m_EventRecorder.RecordEvent(e);
+
+		m_RedrawRequested = true;
+
+		if (m_PendingInputTime < 0.0 && e.IsInCategory(EventCategoryInput))
+			m_PendingInputTime = glfwGetTime();
+
+		Input::OnEvent(e);
+
 		EventDispatcher dispatcher(e);
 		dispatcher.Dispatch<WindowCloseEvent>(BIND_EVENT_FN(OnWindowClose));
 
-		for (auto it = m_LayerStack.end(); it != m_LayerStack.begin(); )
-		{
-			(*--it)->OnEvent(e);
-			if (e.Handled)
-				break;
-		}
+		m_LayerStack.OnEvent(e);
 	}
 
 	void Application::Run()
 	{
+		if (m_PipelinedRendering)
+		{
+			m_ImGuiLayer->CreateDeviceObjects();
+			m_RenderThread.Start(*m_Window, m_MaxFrameLatency);
+		}
+
 		while (m_Running)
 		{
-			float time = (float)glfwGetTime();
+			bool reactive = m_RunMode.load(std::memory_order_relaxed) == RunMode::Reactive && !m_ReplayingEvents;
+			if (reactive && !WaitForRedraw())
+				continue;
+			m_RedrawRequested = false;
+
+			GLCORE_PROFILE_SCOPE("Application::Frame");
+			double frameStartTime = glfwGetTime();
+			float time = (float)frameStartTime;
 			Timestep timestep = time - m_LastFrameTime;
 			m_LastFrameTime = time;
+			m_LastRenderTime = frameStartTime;
+
+			// Time spent sleeping is not one long animation step
+			if (reactive)
+				timestep = std::min((float)timestep, 0.1f);
+
+			if (m_PipelinedRendering)
+				m_Window->PollEvents();
 
-			for (Layer* layer : m_LayerStack)
-				layer->OnUpdate(timestep);
+			if (m_ReplayingEvents)
+			{
+				if (m_ReplayFrame == m_EventReplay.GetFrameCount())
+				{
+					EventReplay::ReportFrameTimes(m_ReplayFrameTimes, m_ReplaySpecification.FrameTimesOutput, m_ReplaySpecification.BaselineFrameTimes);
+					m_ReplayingEvents = false;
+					break;
+				}
 
-			m_ImGuiLayer->Begin();
-			for (Layer* layer : m_LayerStack)
-				layer->OnImGuiRender();
+				const RecordedFrame& frame = m_EventReplay.GetFrames()[m_ReplayFrame++];
+				timestep = frame.Timestep;
+
+				m_DispatchingReplayEvent = true;
+				for (const RecordedEvent& recorded : frame.Events)
+					EventReplay::Dispatch(recorded, BIND_EVENT_FN(OnEvent));
+				m_DispatchingReplayEvent = false;
+			}
+
+			Input::NewFrame();
+			m_EventRecorder.RecordFrame(timestep);
+
+			SubmitRenderCommand([this]() { m_AssetManager.Update(); });
+
+			double inputTime = m_PendingInputTime;
+			m_PendingInputTime = -1.0;
+
+			uint32_t width = m_Window->GetWidth(), height = m_Window->GetHeight();
+			bool renderScene = m_DynamicResolutionEnabled && width > 0 && height > 0;
+			if (renderScene)
+				SubmitRenderCommand([this, width, height]() { BeginScene(width, height); });
+
+			m_LayerStack.OnUpdate(timestep);
+
+			if (renderScene)
+				SubmitRenderCommand([this, width, height]() { EndScene(width, height); });
+
+			if (m_ImGuiLayer->Begin())
+				m_LayerStack.OnImGuiRender();
 			m_ImGuiLayer->End();
 
-			m_Window->OnUpdate();
+			SubmitRenderCommand([]() { Utils::EndGLDebugFrame(); });
+
+			if (m_PipelinedRendering)
+			{
+				m_RenderThread.EndFrame(inputTime);
+			}
+			else
+			{
+				m_Window->OnUpdate();
+				if (inputTime >= 0.0)
+				{
+					m_InputLatency = (float)((glfwGetTime() - inputTime) * 1000.0);
+					m_AverageInputLatency = m_AverageInputLatency * 0.9f + m_InputLatency * 0.1f;
+				}
+			}
+
+			if (m_ReplayingEvents)
+				m_ReplayFrameTimes.push_back((float)((glfwGetTime() - frameStartTime) * 1000.0));
 		}
+
+		m_RenderThread.Stop();
 	}
 
 	bool Application::OnWindowClose(WindowCloseEvent& e)
@@ -6,37 +6,153 @@
 #include "LayerStack.h"
 #include "../Events/Event.h"
 #include "../Events/ApplicationEvent.h"
+#include "../Events/EventRecorder.h"
 
 #include "Timestep.h"
 
-#include "../ImGui/ImGuiLayer.h"
+#include "../Renderer/RenderThread.h"
+#include "../Renderer/GPUTimer.h"
+#include "../Renderer/DynamicResolution.h"
+
+#include "../Asset/AssetManager.h"
+
+#include <atomic>
 
 namespace GLCore {
 
+	class ImGuiLayer;
+	namespace Utils { class Framebuffer; }
+
+	enum class RunMode
+	{
+		Continuous = 0, // Render every frame
+		Reactive        // Sleep until something needs a new frame
+	};
+
+	struct EventReplaySpecification
+	{
+		std::string Filepath;
+		// Optional CSV output of the replayed frame times, and the output of
+		// an earlier replay to compare against
+		std::string FrameTimesOutput;
+		std::string BaselineFrameTimes;
+	};
+
 	class Application
 	{
 	public:
 		Application(const std::string& name = "OpenGL Sandbox", uint32_t width = 1280, uint32_t height = 720);
-		virtual ~Application() = default;
+		virtual ~Application();
 
 		void Run();
 
 		void OnEvent(Event& e);
 
-		void PushLayer(Layer* layer);
-		void PushOverlay(Layer* layer);
+		// The application takes ownership; see LayerStack for priorities
+		void PushLayer(Layer* layer, int32_t priority = 0);
+		void PushOverlay(Layer* layer, int32_t priority = 0);
 
 		inline Window& GetWindow() { return *m_Window; }
+		inline LayerStack& GetLayerStack() { return m_LayerStack; }
+		inline ImGuiLayer& GetImGuiLayer() { return *m_ImGuiLayer; }
+		// Updated on the GL context thread at the start of every frame
+		inline AssetManager& GetAssetManager() { return m_AssetManager; }
+
+		// Optional pipelined mode, must be enabled before Run(). Updates for
+		// frame N+1 then overlap GL submission of frame N on a render thread
+		// that owns the context, so layers must issue GL work through
+		// SubmitRenderCommand. ImGui multi-viewport is unavailable in this mode.
+		void EnablePipelinedRendering(uint32_t maxFrameLatency = 1);
+		bool IsPipelinedRendering() const { return m_PipelinedRendering; }
+
+		// Runs function on the GL context thread: immediately by default, or as
+		// part of the current frame's replay on the render thread
+		void SubmitRenderCommand(RenderThread::RenderFunction function);
+
+		// Time from the first input event of a frame until that frame was
+		// swapped, in milliseconds
+		float GetInputLatency() const;
+		float GetAverageInputLatency() const;
+
+		// Layers render into an offscreen target whose resolution follows the
+		// GPU time of the scene; it is upscaled to the window before ImGui draws
+		// at native resolution. In pipelined mode, enable it before Run().
+		void EnableDynamicResolution(const DynamicResolutionSpecification& specification = DynamicResolutionSpecification());
+		bool IsDynamicResolutionEnabled() const { return m_DynamicResolutionEnabled; }
+		// Safe from any thread; in pipelined mode they lag the render thread
+		float GetRenderScale() const { return m_RenderScale.load(std::memory_order_relaxed); }
+		float GetSceneGPUTime() const { return m_SceneGPUTime.load(std::memory_order_relaxed); }
+
+		// Reactive mode renders a frame only after an event, a RequestRedraw(),
+		// while an animation runs, a key or button is held or the UI is still
+		// settling, and sleeps in the window's event wait otherwise. A frame is
+		// still rendered every maxIdleTime seconds (0 waits indefinitely).
+		// Event replay always runs continuously.
+		void SetRunMode(RunMode mode, double maxIdleTime = 1.0);
+		RunMode GetRunMode() const { return m_RunMode.load(std::memory_order_relaxed); }
+
+		// Safe to call from any thread; wakes the main loop if it is waiting
+		void RequestRedraw();
+		// Frames render continuously between these calls, which may nest
+		void BeginAnimation() { m_ActiveAnimations++; RequestRedraw(); }
+		void EndAnimation() { m_ActiveAnimations--; }
+
+		// Records every event reaching OnEvent with the frame timesteps
+		void StartEventRecording(const std::string& filepath);
+		void StopEventRecording();
+
+		// Must be called before Run(). Live input is ignored and the recording
+		// drives the application with its original timesteps; the application
+		// closes when the recording ends and reports per-frame timings.
+		bool StartEventReplay(const EventReplaySpecification& specification);
+		bool IsReplayingEvents() const { return m_ReplayingEvents; }
 
 		inline static Application& Get() { return *s_Instance; }
 	private:
 		bool OnWindowClose(WindowCloseEvent& e);
+
+		bool NeedsRedraw() const;
+		// Returns false if the loop should check m_Running and wait again
+		bool WaitForRedraw();
+
+		void BeginScene(uint32_t width, uint32_t height);
+		void EndScene(uint32_t width, uint32_t height);
 	private:
 		std::unique_ptr<Window> m_Window;
 		ImGuiLayer* m_ImGuiLayer;
 		bool m_Running = true;
+		// Shut down in ~Application, after the layer stack is cleared
+		AssetManager m_AssetManager;
 		LayerStack m_LayerStack;
 		float m_LastFrameTime = 0.0f;
+
+		RenderThread m_RenderThread;
+		bool m_PipelinedRendering = false;
+		uint32_t m_MaxFrameLatency = 1;
+
+		bool m_DynamicResolutionEnabled = false;
+		// Controller, timer and framebuffer live on the GL context thread;
+		// their results are published through the atomics
+		DynamicResolution m_DynamicResolution;
+		GPUTimer m_SceneTimer;
+		std::atomic<float> m_RenderScale = 1.0f, m_SceneGPUTime = 0.0f;
+		std::unique_ptr<Utils::Framebuffer> m_SceneFramebuffer;
+
+		// Atomic because RequestRedraw() reads it from any thread
+		std::atomic<RunMode> m_RunMode = RunMode::Continuous;
+		double m_MaxIdleTime = 1.0, m_LastRenderTime = 0.0;
+		std::atomic<bool> m_RedrawRequested = true;
+		std::atomic<int32_t> m_ActiveAnimations = 0;
+
+		EventRecorder m_EventRecorder;
+		EventReplay m_EventReplay;
+		EventReplaySpecification m_ReplaySpecification;
+		bool m_ReplayingEvents = false, m_DispatchingReplayEvent = false;
+		uint32_t m_ReplayFrame = 0;
+		std::vector<float> m_ReplayFrameTimes;
+
+		double m_PendingInputTime = -1.0;
+		float m_InputLatency = 0.0f, m_AverageInputLatency = 0.0f;
 	private:
 		static Application* s_Instance;
 	};
@@ -0,0 +1,155 @@
+#include "glpch.h"
+#include "AsyncLogSink.h"
+
+namespace GLCore {
+
+	AsyncLogSink::AsyncLogSink(std::vector<spdlog::sink_ptr> sinks, size_t queueSize, LogOverflowPolicy overflowPolicy)
+		: m_Sinks(std::move(sinks)), m_Queue(queueSize), m_OverflowPolicy(overflowPolicy)
+	{
+		m_Running = true;
+		m_Thread = std::thread(&AsyncLogSink::ThreadLoop, this);
+	}
+
+	AsyncLogSink::~AsyncLogSink()
+	{
+		Stop();
+	}
+
+	void AsyncLogSink::Stop()
+	{
+		if (!m_Running.exchange(false))
+			return;
+
+		m_WakeCondition.notify_one();
+		m_Thread.join();
+
+		// Producers that saw the sink running may have pushed after the
+		// thread's last pop
+		Drain();
+	}
+
+	void AsyncLogSink::sink_it_(const spdlog::details::log_msg& msg)
+	{
+		if (!m_Running.load(std::memory_order_relaxed))
+		{
+			WriteToSinks(msg);
+			return;
+		}
+
+		auto writer = [&msg](Entry& entry)
+		{
+			entry.Message = msg;
+			entry.Payload.assign(msg.payload.data(), msg.payload.size());
+			entry.Message.payload = spdlog::string_view_t(entry.Payload.data(), entry.Payload.size());
+		};
+
+		while (!m_Queue.TryPush(writer))
+		{
+			if (m_OverflowPolicy == LogOverflowPolicy::Drop)
+			{
+				m_DroppedCount++;
+				return;
+			}
+
+			if (m_OverflowPolicy == LogOverflowPolicy::OverwriteOldest)
+			{
+				if (m_Queue.TryPop([](Entry&) {}))
+				{
+					m_DroppedCount++;
+					m_RetiredCount++;
+				}
+				continue;
+			}
+
+			// Nobody else frees slots once the flush thread has stopped
+			if (m_Running.load())
+				m_WakeCondition.notify_one();
+			else
+				Drain();
+			std::this_thread::yield();
+		}
+		m_PushedCount++;
+
+		// Stop() may have drained the queue between the check above and the push
+		if (!m_Running.load())
+			Drain();
+		else if (m_Sleeping.load(std::memory_order_relaxed))
+			m_WakeCondition.notify_one();
+	}
+
+	void AsyncLogSink::flush_()
+	{
+		// An empty queue is not enough: the flush thread may still be writing
+		// the message it popped last
+		uint64_t pushed = m_PushedCount.load();
+		while (m_RetiredCount.load() < pushed)
+		{
+			if (m_Running.load())
+				m_WakeCondition.notify_one();
+			else
+				Drain();
+			std::this_thread::yield();
+		}
+
+		for (auto& sink : m_Sinks)
+			sink->flush();
+	}
+
+	void AsyncLogSink::set_pattern_(const std::string& pattern)
+	{
+		for (auto& sink : m_Sinks)
+			sink->set_pattern(pattern);
+	}
+
+	void AsyncLogSink::set_formatter_(std::unique_ptr<spdlog::formatter> formatter)
+	{
+		for (auto& sink : m_Sinks)
+			sink->set_formatter(formatter->clone());
+	}
+
+	void AsyncLogSink::WriteToSinks(const spdlog::details::log_msg& msg)
+	{
+		for (auto& sink : m_Sinks)
+		{
+			if (sink->should_log(msg.level))
+				sink->log(msg);
+		}
+	}
+
+	void AsyncLogSink::Drain()
+	{
+		while (m_Queue.TryPop([this](Entry& entry) { WriteToSinks(entry.Message); }))
+			m_RetiredCount++;
+	}
+
+	void AsyncLogSink::ThreadLoop()
+	{
+		while (true)
+		{
+			bool wrote = false;
+			while (m_Queue.TryPop([this](Entry& entry) { WriteToSinks(entry.Message); }))
+			{
+				m_RetiredCount++;
+				wrote = true;
+			}
+
+			if (wrote)
+			{
+				for (auto& sink : m_Sinks)
+					sink->flush();
+				continue;
+			}
+
+			if (!m_Running.load())
+				break;
+
+			// Producers only notify while this flag is set; the timeout bounds
+			// the delay if a notification slips in before the wait starts
+			std::unique_lock<std::mutex> lock(m_WakeMutex);
+			m_Sleeping = true;
+			m_WakeCondition.wait_for(lock, std::chrono::milliseconds(10));
+			m_Sleeping = false;
+		}
+	}
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Log.h"
+#include "MPMCQueue.h"
+
+#include "spdlog/sinks/base_sink.h"
+#include "spdlog/details/null_mutex.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace GLCore {
+
+	// Copies each message into a lock-free bounded queue and writes it to the
+	// wrapped sinks from a background thread, so logging threads never wait
+	// on console or file I/O. After Stop() messages are written synchronously.
+	class AsyncLogSink : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
+	{
+	public:
+		AsyncLogSink(std::vector<spdlog::sink_ptr> sinks, size_t queueSize, LogOverflowPolicy overflowPolicy);
+		~AsyncLogSink();
+
+		// Drains the queue and joins the flush thread
+		void Stop();
+
+		uint64_t GetDroppedCount() const { return m_DroppedCount.load(); }
+	protected:
+		void sink_it_(const spdlog::details::log_msg& msg) override;
+		void flush_() override;
+		void set_pattern_(const std::string& pattern) override;
+		void set_formatter_(std::unique_ptr<spdlog::formatter> formatter) override;
+	private:
+		struct Entry
+		{
+			spdlog::details::log_msg Message;
+			std::string Payload; // Owns the text Message.payload points at
+		};
+
+		void WriteToSinks(const spdlog::details::log_msg& msg);
+		// Writes whatever is queued on the calling thread
+		void Drain();
+		void ThreadLoop();
+	private:
+		std::vector<spdlog::sink_ptr> m_Sinks;
+		MPMCQueue<Entry> m_Queue;
+		LogOverflowPolicy m_OverflowPolicy;
+
+		std::thread m_Thread;
+		std::atomic<bool> m_Running = false;
+		std::atomic<bool> m_Sleeping = false;
+		std::mutex m_WakeMutex;
+		std::condition_variable m_WakeCondition;
+
+		// A message is retired once written or overwritten; flush_ waits for
+		// the retired count to reach the pushed count it started with
+		std::atomic<uint64_t> m_PushedCount = 0, m_RetiredCount = 0;
+		std::atomic<uint64_t> m_DroppedCount = 0;
+	};
+
+}
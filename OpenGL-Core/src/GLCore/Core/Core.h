@@ -1,16 +1,30 @@
 // Mostly from Hazel
 #pragma once
 
+#include <functional>
 #include <memory>
 
+#if defined(GLCORE_PLATFORM_WINDOWS)
+	#define GLCORE_DEBUGBREAK() __debugbreak()
+#elif defined(GLCORE_PLATFORM_LINUX)
+	#include <signal.h>
+	#define GLCORE_DEBUGBREAK() raise(SIGTRAP)
+#else
+	#define GLCORE_DEBUGBREAK()
+#endif
+
 #ifdef GLCORE_DEBUG
 	#define GLCORE_ENABLE_ASSERTS
 #endif
 
 #ifdef GLCORE_ENABLE_ASSERTS
-	#define GLCORE_ASSERT(x, ...) { if(!(x)) { LOG_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
+	namespace GLCore {
+		// Defined in Log.cpp so that asserting does not pull spdlog into the header
+		void ReportAssertionFailure(const char* message);
+	}
+	#define GLCORE_ASSERT(x, ...) do { if(!(x)) { ::GLCore::ReportAssertionFailure(__VA_ARGS__); GLCORE_DEBUGBREAK(); } } while (0)
 #else
-	#define GLCORE_ASSERT(x, ...)
+	#define GLCORE_ASSERT(x, ...) ((void)0)
 #endif
 
 #define BIT(x) (1 << x)
@@ -0,0 +1,86 @@
+#include "glpch.h"
+#include "Input.h"
+
+#include "GLCore/Events/KeyEvent.h"
+#include "GLCore/Events/MouseEvent.h"
+
+namespace GLCore {
+
+	Input::State Input::s_Frame;
+	Input::State Input::s_Pending;
+
+	void Input::OnEvent(Event& e)
+	{
+		switch (e.GetEventType())
+		{
+			case EventType::KeyPressed:
+			{
+				auto& event = (KeyPressedEvent&)e;
+				int keycode = event.GetKeyCode();
+				if (IsValidKey(keycode) && event.GetRepeatCount() == 0)
+				{
+					s_Pending.Keys.set(keycode);
+					s_Pending.KeysPressed.set(keycode);
+				}
+				break;
+			}
+			case EventType::KeyReleased:
+			{
+				int keycode = ((KeyReleasedEvent&)e).GetKeyCode();
+				if (IsValidKey(keycode))
+				{
+					s_Pending.Keys.reset(keycode);
+					s_Pending.KeysReleased.set(keycode);
+				}
+				break;
+			}
+			case EventType::MouseButtonPressed:
+			{
+				int button = ((MouseButtonPressedEvent&)e).GetMouseButton();
+				if (IsValidButton(button))
+				{
+					s_Pending.MouseButtons.set(button);
+					s_Pending.MouseButtonsPressed.set(button);
+				}
+				break;
+			}
+			case EventType::MouseButtonReleased:
+			{
+				int button = ((MouseButtonReleasedEvent&)e).GetMouseButton();
+				if (IsValidButton(button))
+				{
+					s_Pending.MouseButtons.reset(button);
+					s_Pending.MouseButtonsReleased.set(button);
+				}
+				break;
+			}
+			case EventType::MouseMoved:
+			{
+				auto& event = (MouseMovedEvent&)e;
+				s_Pending.MouseX = event.GetX();
+				s_Pending.MouseY = event.GetY();
+				break;
+			}
+			default:
+				break;
+		}
+	}
+
+	void Input::NewFrame()
+	{
+		// Edges are accumulated separately from the held state, so a key
+		// tapped between two frames still reports both edges
+		s_Frame = s_Pending;
+		s_Pending.KeysPressed.reset();
+		s_Pending.KeysReleased.reset();
+		s_Pending.MouseButtonsPressed.reset();
+		s_Pending.MouseButtonsReleased.reset();
+	}
+
+	void Input::Reset()
+	{
+		s_Frame = State();
+		s_Pending = State();
+	}
+
+}
@@ -1,32 +1,55 @@
 #pragma once
 
 #include "Core.h"
+#include "GLCore/Events/Event.h"
+
+#include <bitset>
 
 namespace GLCore {
 
+	// Input state as of the start of the current frame. The Application feeds
+	// every window event through OnEvent and latches the result with
+	// NewFrame, so queries are plain bit tests and the whole state follows
+	// deterministically from the event stream (which makes replay exact).
 	class Input
 	{
-	protected:
-		Input() = default;
 	public:
-		Input(const Input&) = delete;
-		Input& operator=(const Input&) = delete;
-
-		inline static bool IsKeyPressed(int keycode) { return s_Instance->IsKeyPressedImpl(keycode); }
-
-		inline static bool IsMouseButtonPressed(int button) { return s_Instance->IsMouseButtonPressedImpl(button); }
-		inline static std::pair<float, float> GetMousePosition() { return s_Instance->GetMousePositionImpl(); }
-		inline static float GetMouseX() { return s_Instance->GetMouseXImpl(); }
-		inline static float GetMouseY() { return s_Instance->GetMouseYImpl(); }
-	protected:
-		virtual bool IsKeyPressedImpl(int keycode) = 0;
-
-		virtual bool IsMouseButtonPressedImpl(int button) = 0;
-		virtual std::pair<float, float> GetMousePositionImpl() = 0;
-		virtual float GetMouseXImpl() = 0;
-		virtual float GetMouseYImpl() = 0;
+		static constexpr int MaxKeys = 512;
+		static constexpr int MaxMouseButtons = 8;
+
+		Input() = delete;
+
+		inline static bool IsKeyPressed(int keycode) { return IsValidKey(keycode) && s_Frame.Keys[keycode]; }
+		inline static bool WasKeyPressedThisFrame(int keycode) { return IsValidKey(keycode) && s_Frame.KeysPressed[keycode]; }
+		inline static bool WasKeyReleasedThisFrame(int keycode) { return IsValidKey(keycode) && s_Frame.KeysReleased[keycode]; }
+
+		inline static bool IsMouseButtonPressed(int button) { return IsValidButton(button) && s_Frame.MouseButtons[button]; }
+		inline static bool WasMouseButtonPressedThisFrame(int button) { return IsValidButton(button) && s_Frame.MouseButtonsPressed[button]; }
+		inline static bool WasMouseButtonReleasedThisFrame(int button) { return IsValidButton(button) && s_Frame.MouseButtonsReleased[button]; }
+
+		inline static std::pair<float, float> GetMousePosition() { return { s_Frame.MouseX, s_Frame.MouseY }; }
+		inline static float GetMouseX() { return s_Frame.MouseX; }
+		inline static float GetMouseY() { return s_Frame.MouseY; }
+
+		inline static bool IsAnyKeyOrButtonHeld() { return s_Frame.Keys.any() || s_Frame.MouseButtons.any(); }
+
+		// Engine side
+		static void OnEvent(Event& e);
+		static void NewFrame();
+		static void Reset();
+	private:
+		struct State
+		{
+			std::bitset<MaxKeys> Keys, KeysPressed, KeysReleased;
+			std::bitset<MaxMouseButtons> MouseButtons, MouseButtonsPressed, MouseButtonsReleased;
+			float MouseX = 0.0f, MouseY = 0.0f;
+		};
+
+		inline static bool IsValidKey(int keycode) { return (unsigned)keycode < (unsigned)MaxKeys; }
+		inline static bool IsValidButton(int button) { return (unsigned)button < (unsigned)MaxMouseButtons; }
 	private:
-		static Input* s_Instance;
+		static State s_Frame;   // What queries see
+		static State s_Pending; // Accumulates events until the next NewFrame
 	};
 
-}
\ No newline at end of file
+}
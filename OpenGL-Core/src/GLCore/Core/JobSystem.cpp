@@ -0,0 +1,282 @@
+#include "glpch.h"
+#include "JobSystem.h"
+
+#include "Profile.h"
+#include "WorkStealingDeque.h"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+namespace GLCore {
+
+	struct Job
+	{
+		JobSystem::JobFunction Function;
+		JobCounter* Counter = nullptr;
+	};
+
+	struct JobSystemData
+	{
+		uint32_t ThreadCount = 0;
+		std::vector<std::unique_ptr<WorkStealingDeque<Job>>> Queues;
+		std::vector<std::thread> Workers;
+
+		// Jobs scheduled from threads that do not own a deque
+		std::mutex InjectMutex;
+		std::deque<Job*> Injected;
+
+		std::atomic<bool> Running = false;
+		std::atomic<int32_t> Pending = 0;
+		std::atomic<uint32_t> Sleeping = 0;
+		std::mutex WakeMutex;
+		std::condition_variable WakeCondition;
+	};
+
+	static JobSystemData* s_Data = nullptr;
+	static thread_local uint32_t s_ThreadIndex = JobSystem::InvalidThreadIndex;
+	static thread_local uint32_t s_StealSeed = 0x9E3779B9;
+
+	void JobSystem::Init(uint32_t threadCount)
+	{
+		GLCORE_ASSERT(!s_Data, "JobSystem already initialized!");
+
+		if (threadCount == 0)
+			threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+		s_Data = new JobSystemData();
+		s_Data->ThreadCount = threadCount;
+		for (uint32_t i = 0; i < threadCount; i++)
+			s_Data->Queues.emplace_back(std::make_unique<WorkStealingDeque<Job>>());
+
+		s_ThreadIndex = 0;
+		s_Data->Running = true;
+		for (uint32_t i = 1; i < threadCount; i++)
+			s_Data->Workers.emplace_back(WorkerLoop, i);
+
+		LOG_INFO("JobSystem: {0} threads", threadCount);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		if (!s_Data)
+			return;
+
+		// Drain whatever is left so counters and continuations still fire
+		while (Job* job = FindJob())
+			Execute(job);
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data->WakeMutex);
+			s_Data->Running = false;
+		}
+		s_Data->WakeCondition.notify_all();
+
+		for (std::thread& worker : s_Data->Workers)
+			worker.join();
+
+		delete s_Data;
+		s_Data = nullptr;
+		s_ThreadIndex = InvalidThreadIndex;
+	}
+
+	bool JobSystem::IsInitialized()
+	{
+		return s_Data != nullptr;
+	}
+
+	uint32_t JobSystem::GetThreadCount()
+	{
+		return s_Data ? s_Data->ThreadCount : 1;
+	}
+
+	uint32_t JobSystem::GetThreadIndex()
+	{
+		return s_ThreadIndex;
+	}
+
+	void JobSystem::Run(JobFunction function, JobCounter* counter)
+	{
+		if (counter)
+			counter->m_Count.fetch_add(1, std::memory_order_relaxed);
+
+		Schedule(new Job{ std::move(function), counter });
+	}
+
+	void JobSystem::RunAfter(JobCounter& dependency, JobFunction function, JobCounter* counter)
+	{
+		if (counter)
+			counter->m_Count.fetch_add(1, std::memory_order_relaxed);
+
+		Job* job = new Job{ std::move(function), counter };
+		{
+			std::lock_guard<std::mutex> lock(dependency.m_ContinuationMutex);
+			// Checks the raw count, not IsDone(): once it is zero the finishing
+			// job may already have taken the continuation list
+			if (dependency.m_Count.load() != 0)
+			{
+				dependency.m_Continuations.push_back(job);
+				return;
+			}
+		}
+		Schedule(job);
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			if (Job* job = FindJob())
+				Execute(job);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const RangeFunction& function)
+	{
+		if (count == 0)
+			return;
+
+		if (batchSize == 0)
+			batchSize = std::max(1u, count / (GetThreadCount() * 4));
+
+		JobCounter counter;
+		for (uint32_t begin = batchSize; begin < count; begin += batchSize)
+		{
+			uint32_t end = std::min(begin + batchSize, count);
+			Run([&function, begin, end]() { function(begin, end); }, &counter);
+		}
+
+		// The first batch runs on the calling thread
+		function(0, std::min(batchSize, count));
+		Wait(counter);
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, const std::function<void(uint32_t index)>& function)
+	{
+		ParallelFor(count, 0, [&function](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+				function(i);
+		});
+	}
+
+	void JobSystem::Schedule(Job* job)
+	{
+		if (!s_Data)
+		{
+			// Not initialized: behave like a synchronous call
+			Execute(job);
+			return;
+		}
+
+		uint32_t index = s_ThreadIndex;
+		if (index != InvalidThreadIndex)
+		{
+			if (!s_Data->Queues[index]->Push(job))
+			{
+				Execute(job);
+				return;
+			}
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock(s_Data->InjectMutex);
+			s_Data->Injected.push_back(job);
+		}
+
+		s_Data->Pending.fetch_add(1);
+		if (s_Data->Sleeping.load() > 0)
+		{
+			// Taking the lock orders this notify after a sleeper's predicate check
+			{ std::lock_guard<std::mutex> lock(s_Data->WakeMutex); }
+			s_Data->WakeCondition.notify_one();
+		}
+	}
+
+	Job* JobSystem::FindJob()
+	{
+		if (!s_Data)
+			return nullptr;
+
+		Job* job = nullptr;
+		uint32_t index = s_ThreadIndex;
+		if (index != InvalidThreadIndex)
+			job = s_Data->Queues[index]->Pop();
+
+		if (!job && s_Data->Pending.load(std::memory_order_relaxed) > 0)
+		{
+			{
+				std::lock_guard<std::mutex> lock(s_Data->InjectMutex);
+				if (!s_Data->Injected.empty())
+				{
+					job = s_Data->Injected.front();
+					s_Data->Injected.pop_front();
+				}
+			}
+
+			// Steal, starting at a random victim so thieves spread out
+			uint32_t threadCount = s_Data->ThreadCount;
+			s_StealSeed ^= s_StealSeed << 13; s_StealSeed ^= s_StealSeed >> 17; s_StealSeed ^= s_StealSeed << 5;
+			for (uint32_t i = 0; !job && i < threadCount; i++)
+			{
+				uint32_t victim = (s_StealSeed + i) % threadCount;
+				if (victim != index)
+					job = s_Data->Queues[victim]->Steal();
+			}
+		}
+
+		if (job)
+			s_Data->Pending.fetch_sub(1);
+		return job;
+	}
+
+	void JobSystem::Execute(Job* job)
+	{
+		{
+			GLCORE_PROFILE_SCOPE("JobSystem::Execute");
+			job->Function();
+		}
+
+		if (JobCounter* counter = job->Counter)
+		{
+			std::vector<Job*> continuations;
+
+			counter->m_Releasing.fetch_add(1);
+			if (counter->m_Count.fetch_sub(1) == 1)
+			{
+				std::lock_guard<std::mutex> lock(counter->m_ContinuationMutex);
+				continuations.swap(counter->m_Continuations);
+			}
+			// Last access; waiters may destroy the counter after this
+			counter->m_Releasing.fetch_sub(1);
+
+			for (Job* continuation : continuations)
+				Schedule(continuation);
+		}
+
+		delete job;
+	}
+
+	void JobSystem::WorkerLoop(uint32_t threadIndex)
+	{
+		s_ThreadIndex = threadIndex;
+		s_StealSeed = 0x9E3779B9 * (threadIndex + 1);
+
+		while (s_Data->Running.load())
+		{
+			if (Job* job = FindJob())
+			{
+				Execute(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(s_Data->WakeMutex);
+			s_Data->Sleeping.fetch_add(1);
+			s_Data->WakeCondition.wait(lock, []() { return s_Data->Pending.load() > 0 || !s_Data->Running.load(); });
+			s_Data->Sleeping.fetch_sub(1);
+		}
+	}
+
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Core.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace GLCore {
+
+	struct Job;
+
+	// Counts outstanding jobs. Jobs that were scheduled with RunAfter() on
+	// this counter are released once it drops to zero. A counter must not be
+	// re-armed while jobs are still waiting on it.
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		// Also waits out a finishing job that is still releasing continuations,
+		// so the counter may be destroyed as soon as this returns true
+		bool IsDone() const { return m_Count.load() == 0 && m_Releasing.load() == 0; }
+		uint32_t GetValue() const { return m_Count.load(); }
+	private:
+		friend class JobSystem;
+
+		std::atomic<uint32_t> m_Count = 0;
+		std::atomic<uint32_t> m_Releasing = 0;
+		std::mutex m_ContinuationMutex;
+		std::vector<Job*> m_Continuations;
+	};
+
+	// Fixed pool of worker threads, each owning a Chase-Lev deque. Idle
+	// workers steal from each other. The thread that calls Init() becomes
+	// thread index 0 and takes part in the work whenever it Wait()s.
+	class JobSystem
+	{
+	public:
+		using JobFunction = std::function<void()>;
+		using RangeFunction = std::function<void(uint32_t begin, uint32_t end)>;
+
+		static constexpr uint32_t InvalidThreadIndex = 0xFFFFFFFF;
+
+		// threadCount = 0 uses every hardware thread (including the caller)
+		static void Init(uint32_t threadCount = 0);
+		static void Shutdown();
+		static bool IsInitialized();
+
+		// Total threads taking part in work, including the main thread
+		static uint32_t GetThreadCount();
+		// 0 for the main thread, 1..N-1 for workers, InvalidThreadIndex otherwise
+		static uint32_t GetThreadIndex();
+
+		// counter (optional) is incremented now and decremented once the job ran
+		static void Run(JobFunction function, JobCounter* counter = nullptr);
+		// Like Run, but the job is only queued once dependency reaches zero
+		static void RunAfter(JobCounter& dependency, JobFunction function, JobCounter* counter = nullptr);
+
+		// Executes queued jobs on the calling thread until the counter is done
+		static void Wait(JobCounter& counter);
+
+		// Splits [0, count) into batches of batchSize and blocks until all ran
+		static void ParallelFor(uint32_t count, uint32_t batchSize, const RangeFunction& function);
+		static void ParallelFor(uint32_t count, const std::function<void(uint32_t index)>& function);
+	private:
+		static void Schedule(Job* job);
+		static Job* FindJob();
+		static void Execute(Job* job);
+		static void WorkerLoop(uint32_t threadIndex);
+	};
+
+}
@@ -1,50 +1,258 @@
 #include "glpch.h"
 #include "LayerStack.h"
 
+#include "Profile.h"
+
+#include <chrono>
+
 namespace GLCore {
 
-	LayerStack::LayerStack()
+	using Clock = std::chrono::steady_clock;
+
+	static float MillisecondsSince(Clock::time_point start)
 	{
+		return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
 	}
 
-	LayerStack::~LayerStack()
+	static float Smooth(float average, float value)
 	{
-		for (Layer* layer : m_Layers)
-			delete layer;
+		return average * 0.95f + value * 0.05f;
 	}
 
-	void LayerStack::PushLayer(Layer* layer)
+	Layer* LayerStack::PushLayer(std::unique_ptr<Layer> layer, int32_t priority)
 	{
-		m_Layers.emplace(m_Layers.begin() + m_LayerInsertIndex, layer);
-		m_LayerInsertIndex++;
-		layer->OnAttach();
+		return Push(std::move(layer), false, priority);
 	}
 
-	void LayerStack::PushOverlay(Layer* overlay)
+	Layer* LayerStack::PushOverlay(std::unique_ptr<Layer> overlay, int32_t priority)
 	{
-		m_Layers.emplace_back(overlay);
-		overlay->OnAttach();
+		return Push(std::move(overlay), true, priority);
 	}
 
 	void LayerStack::PopLayer(Layer* layer)
 	{
-		auto it = std::find(m_Layers.begin(), m_Layers.begin() + m_LayerInsertIndex, layer);
-		if (it != m_Layers.begin() + m_LayerInsertIndex)
+		Pop(layer, false);
+	}
+
+	void LayerStack::PopOverlay(Layer* overlay)
+	{
+		Pop(overlay, true);
+	}
+
+	Layer* LayerStack::Push(std::unique_ptr<Layer> layer, bool overlay, int32_t priority)
+	{
+		Layer* result = layer.get();
+		if (m_IterationDepth > 0)
 		{
-			layer->OnDetach();
-			m_Layers.erase(it);
-			m_LayerInsertIndex--;
+			PendingOperation operation;
+			operation.Instance = std::move(layer);
+			operation.Overlay = overlay;
+			operation.Priority = priority;
+			m_Pending.push_back(std::move(operation));
 		}
+		else
+		{
+			Insert(std::move(layer), overlay, priority);
+		}
+		return result;
 	}
 
-	void LayerStack::PopOverlay(Layer* overlay)
+	void LayerStack::Pop(Layer* layer, bool overlay)
+	{
+		if (m_IterationDepth > 0)
+		{
+			// Skipped for the rest of this iteration. Like Remove(), only from
+			// its own group, or a mismatched pop would hide it for good.
+			LayerEntry* entry = Find(layer);
+			if (entry && entry->Overlay == overlay)
+				entry->Removed = true;
+
+			PendingOperation operation;
+			operation.Target = layer;
+			operation.Overlay = overlay;
+			m_Pending.push_back(std::move(operation));
+		}
+		else
+		{
+			Remove(layer, overlay);
+		}
+	}
+
+	void LayerStack::Clear()
+	{
+		GLCORE_ASSERT(m_IterationDepth == 0, "Cannot clear the LayerStack while iterating!");
+		m_Pending.clear();
+		while (!m_Entries.empty())
+		{
+			std::unique_ptr<Layer> instance = std::move(m_Entries.back().Instance);
+			m_Entries.pop_back();
+			instance->OnDetach();
+		}
+	}
+
+	void LayerStack::Insert(std::unique_ptr<Layer> layer, bool overlay, int32_t priority)
+	{
+		// After every entry that sorts before or equal to the new one
+		auto position = std::find_if(m_Entries.begin(), m_Entries.end(), [&](const LayerEntry& entry)
+		{
+			return entry.Overlay != overlay ? entry.Overlay : entry.Priority > priority;
+		});
+
+		LayerEntry entry;
+		entry.Instance = std::move(layer);
+		entry.Overlay = overlay;
+		entry.Priority = priority;
+		Layer* attached = m_Entries.insert(position, std::move(entry))->Instance.get();
+		attached->OnAttach();
+	}
+
+	void LayerStack::Remove(Layer* layer, bool overlay)
+	{
+		auto it = std::find_if(m_Entries.begin(), m_Entries.end(), [&](const LayerEntry& entry)
+		{
+			return entry.Instance.get() == layer && entry.Overlay == overlay;
+		});
+
+		if (it != m_Entries.end())
+		{
+			// Keep the layer alive until it left the stack
+			std::unique_ptr<Layer> instance = std::move(it->Instance);
+			m_Entries.erase(it);
+			instance->OnDetach();
+		}
+	}
+
+	LayerEntry* LayerStack::Find(const Layer* layer)
+	{
+		for (LayerEntry& entry : m_Entries)
+		{
+			if (entry.Instance.get() == layer)
+				return &entry;
+		}
+		return nullptr;
+	}
+
+	const LayerEntry* LayerStack::Find(const Layer* layer) const
+	{
+		return const_cast<LayerStack*>(this)->Find(layer);
+	}
+
+	void LayerStack::SetEnabled(Layer* layer, bool enabled)
+	{
+		LayerEntry* entry = Find(layer);
+		GLCORE_ASSERT(entry, "Layer is not in the stack!");
+		if (entry->Enabled != enabled)
+		{
+			entry->Enabled = enabled;
+			entry->AccumulatedTime = 0.0f;
+			entry->FramesUntilUpdate = 0;
+		}
+	}
+
+	bool LayerStack::IsEnabled(const Layer* layer) const
+	{
+		const LayerEntry* entry = Find(layer);
+		return entry && entry->Enabled;
+	}
+
+	void LayerStack::SetUpdateDivisor(Layer* layer, uint32_t divisor)
+	{
+		LayerEntry* entry = Find(layer);
+		GLCORE_ASSERT(entry, "Layer is not in the stack!");
+		entry->UpdateDivisor = std::max(divisor, 1u);
+		entry->FramesUntilUpdate = std::min(entry->FramesUntilUpdate, entry->UpdateDivisor - 1);
+	}
+
+	const LayerStats* LayerStack::GetStats(const Layer* layer) const
+	{
+		const LayerEntry* entry = Find(layer);
+		return entry ? &entry->Stats : nullptr;
+	}
+
+	void LayerStack::OnUpdate(Timestep ts)
+	{
+		GLCORE_PROFILE_FUNCTION();
+
+		BeginIteration();
+		for (LayerEntry& entry : m_Entries)
+		{
+			if (!entry.Enabled || entry.Removed)
+				continue;
+
+			entry.AccumulatedTime += ts;
+			if (entry.FramesUntilUpdate > 0)
+			{
+				entry.FramesUntilUpdate--;
+				continue;
+			}
+			entry.FramesUntilUpdate = entry.UpdateDivisor - 1;
+
+			GLCORE_PROFILE_SCOPE(entry.Instance->GetName().c_str());
+			Clock::time_point start = Clock::now();
+			entry.Instance->OnUpdate(entry.AccumulatedTime);
+			entry.AccumulatedTime = 0.0f;
+
+			LayerStats& stats = entry.Stats;
+			stats.UpdateTime = MillisecondsSince(start);
+			stats.AverageUpdateTime = stats.UpdateCount++ ? Smooth(stats.AverageUpdateTime, stats.UpdateTime) : stats.UpdateTime;
+		}
+		EndIteration();
+	}
+
+	void LayerStack::OnImGuiRender()
 	{
-		auto it = std::find(m_Layers.begin() + m_LayerInsertIndex, m_Layers.end(), overlay);
-		if (it != m_Layers.end())
+		GLCORE_PROFILE_FUNCTION();
+
+		BeginIteration();
+		for (LayerEntry& entry : m_Entries)
+		{
+			if (!entry.Enabled || entry.Removed)
+				continue;
+
+			Clock::time_point start = Clock::now();
+			entry.Instance->OnImGuiRender();
+
+			LayerStats& stats = entry.Stats;
+			stats.ImGuiTime = MillisecondsSince(start);
+			stats.AverageImGuiTime = Smooth(stats.AverageImGuiTime, stats.ImGuiTime);
+		}
+		EndIteration();
+	}
+
+	void LayerStack::OnEvent(Event& event)
+	{
+		BeginIteration();
+		for (size_t i = m_Entries.size(); i > 0; i--)
+		{
+			LayerEntry& entry = m_Entries[i - 1];
+			if (!entry.Enabled || entry.Removed)
+				continue;
+
+			entry.Instance->OnEvent(event);
+			if (event.Handled)
+				break;
+		}
+		EndIteration();
+	}
+
+	void LayerStack::EndIteration()
+	{
+		GLCORE_ASSERT(m_IterationDepth > 0, "Unbalanced LayerStack iteration!");
+		if (--m_IterationDepth > 0 || m_Pending.empty())
+			return;
+
+		// Callbacks of attached/detached layers may queue more operations
+		m_IterationDepth++;
+		for (size_t i = 0; i < m_Pending.size(); i++)
 		{
-			overlay->OnDetach();
-			m_Layers.erase(it);
+			PendingOperation operation = std::move(m_Pending[i]);
+			if (operation.Instance)
+				Insert(std::move(operation.Instance), operation.Overlay, operation.Priority);
+			else
+				Remove(operation.Target, operation.Overlay);
 		}
+		m_Pending.clear();
+		m_IterationDepth--;
 	}
 
 }
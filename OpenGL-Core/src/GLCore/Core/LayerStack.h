@@ -3,26 +3,94 @@
 #include "Core.h"
 #include "Layer.h"
 
+#include <memory>
 #include <vector>
 
 namespace GLCore {
 
+	struct LayerStats
+	{
+		// Milliseconds spent in the last call, and a moving average
+		float UpdateTime = 0.0f, ImGuiTime = 0.0f;
+		float AverageUpdateTime = 0.0f, AverageImGuiTime = 0.0f;
+		uint64_t UpdateCount = 0;
+	};
+
+	struct LayerEntry
+	{
+		std::unique_ptr<Layer> Instance;
+		int32_t Priority = 0;
+		bool Overlay = false;
+		bool Enabled = true;
+		bool Removed = false; // Popped while iterating, destroyed afterwards
+
+		uint32_t UpdateDivisor = 1;
+		uint32_t FramesUntilUpdate = 0;
+		float AccumulatedTime = 0.0f;
+
+		LayerStats Stats;
+	};
+
+	// Owns the application's layers. Layers sit below overlays; within each
+	// group a higher priority updates and draws later and sees events first,
+	// equal priorities keep push order. Pushes and pops issued while the stack
+	// is being iterated (from inside a layer callback) are applied once the
+	// iteration finishes.
 	class LayerStack
 	{
 	public:
-		LayerStack();
-		~LayerStack();
+		LayerStack() = default;
+		~LayerStack() = default;
 
-		void PushLayer(Layer* layer);
-		void PushOverlay(Layer* overlay);
+		LayerStack(const LayerStack&) = delete;
+		LayerStack& operator=(const LayerStack&) = delete;
+
+		Layer* PushLayer(std::unique_ptr<Layer> layer, int32_t priority = 0);
+		Layer* PushOverlay(std::unique_ptr<Layer> overlay, int32_t priority = 0);
+		// Detaches and destroys the layer
 		void PopLayer(Layer* layer);
 		void PopOverlay(Layer* overlay);
+		// Detaches and destroys every layer, top-most first
+		void Clear();
+
+		// Disabled layers get no updates, ImGui calls or events
+		void SetEnabled(Layer* layer, bool enabled);
+		bool IsEnabled(const Layer* layer) const;
+		// OnUpdate runs every divisor-th frame with the accumulated timestep
+		void SetUpdateDivisor(Layer* layer, uint32_t divisor);
+		const LayerStats* GetStats(const Layer* layer) const;
 
-		std::vector<Layer*>::iterator begin() { return m_Layers.begin(); }
-		std::vector<Layer*>::iterator end() { return m_Layers.end(); }
+		void OnUpdate(Timestep ts);
+		void OnImGuiRender();
+		// Top-most layer first, stops once the event is handled
+		void OnEvent(Event& event);
+
+		// Bottom to top
+		const std::vector<LayerEntry>& GetEntries() const { return m_Entries; }
+		size_t Size() const { return m_Entries.size(); }
 	private:
-		std::vector<Layer*> m_Layers;
-		uint32_t m_LayerInsertIndex = 0;
+		Layer* Push(std::unique_ptr<Layer> layer, bool overlay, int32_t priority);
+		void Pop(Layer* layer, bool overlay);
+		void Insert(std::unique_ptr<Layer> layer, bool overlay, int32_t priority);
+		void Remove(Layer* layer, bool overlay);
+
+		LayerEntry* Find(const Layer* layer);
+		const LayerEntry* Find(const Layer* layer) const;
+
+		void BeginIteration() { m_IterationDepth++; }
+		void EndIteration();
+	private:
+		struct PendingOperation
+		{
+			std::unique_ptr<Layer> Instance; // Set for pushes
+			Layer* Target = nullptr;         // Set for pops
+			bool Overlay = false;
+			int32_t Priority = 0;
+		};
+
+		std::vector<LayerEntry> m_Entries;
+		std::vector<PendingOperation> m_Pending;
+		uint32_t m_IterationDepth = 0;
 	};
 
-}
\ No newline at end of file
+}
@@ -1,17 +1,68 @@
 #include "glpch.h"
 #include "Log.h"
 
+#include "AsyncLogSink.h"
+
 #include "spdlog/sinks/stdout_color_sinks.h"
+#include "spdlog/sinks/rotating_file_sink.h"
+
+#include <cstdio>
 
 namespace GLCore {
 
 	std::shared_ptr<spdlog::logger> Log::s_Logger;
+	static std::shared_ptr<AsyncLogSink> s_AsyncSink;
 
-	void Log::Init()
+	void Log::Init(const LogSpecification& specification)
 	{
-		spdlog::set_pattern("%^[%T] %n: %v%$");
-		s_Logger = spdlog::stdout_color_mt("GLCORE");
+		std::vector<spdlog::sink_ptr> sinks;
+
+		auto consoleSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+		consoleSink->set_pattern("%^[%T] %n: %v%$");
+		sinks.push_back(consoleSink);
+
+		if (!specification.FilePath.empty())
+		{
+			auto fileSink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(specification.FilePath, specification.MaxFileSize, specification.MaxFiles);
+			fileSink->set_pattern("[%Y-%m-%d %T.%e] [%l] [%t] %n: %v");
+			sinks.push_back(fileSink);
+		}
+
+		if (specification.Async)
+		{
+			s_AsyncSink = std::make_shared<AsyncLogSink>(std::move(sinks), specification.QueueSize, specification.OverflowPolicy);
+			s_Logger = std::make_shared<spdlog::logger>("GLCORE", s_AsyncSink);
+		}
+		else
+		{
+			s_Logger = std::make_shared<spdlog::logger>("GLCORE", sinks.begin(), sinks.end());
+		}
+
 		s_Logger->set_level(spdlog::level::trace);
+		// Errors usually precede a break or crash, so make sure they are out
+		s_Logger->flush_on(spdlog::level::err);
+	}
+
+	void Log::Shutdown()
+	{
+		if (s_AsyncSink)
+			s_AsyncSink->Stop();
+
+		if (s_Logger)
+			s_Logger->flush();
+	}
+
+	uint64_t Log::GetDroppedMessageCount()
+	{
+		return s_AsyncSink ? s_AsyncSink->GetDroppedCount() : 0;
+	}
+
+	void ReportAssertionFailure(const char* message)
+	{
+		if (Log::IsInitialized())
+			Log::GetLogger()->error("Assertion Failed: {0}", message);
+		else
+			std::fprintf(stderr, "Assertion Failed: %s\n", message);
 	}
 
-}
\ No newline at end of file
+}
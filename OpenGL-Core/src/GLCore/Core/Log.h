@@ -1,15 +1,40 @@
 #pragma once
 
-#include "Core.h"
 #include "spdlog/spdlog.h"
 #include "spdlog/fmt/ostr.h"
 
 namespace GLCore {
 
+	enum class LogOverflowPolicy
+	{
+		Block = 0,          // Producer yields until the flush thread frees a slot
+		Drop,               // The new message is discarded
+		OverwriteOldest     // The oldest queued message is discarded
+	};
+
+	struct LogSpecification
+	{
+		// Format and write messages on a background thread
+		bool Async = true;
+		size_t QueueSize = 8192; // Must be a power of two
+		LogOverflowPolicy OverflowPolicy = LogOverflowPolicy::Block;
+
+		// Rotating log file, disabled when empty
+		std::string FilePath;
+		size_t MaxFileSize = 5 * 1024 * 1024;
+		size_t MaxFiles = 3;
+	};
+
 	class Log
 	{
 	public:
-		static void Init();
+		static void Init(const LogSpecification& specification = LogSpecification());
+		// Writes out queued messages and stops the flush thread; logging
+		// afterwards is synchronous
+		static void Shutdown();
+
+		static bool IsInitialized() { return s_Logger != nullptr; }
+		static uint64_t GetDroppedMessageCount();
 
 		inline static std::shared_ptr<spdlog::logger>& GetLogger() { return s_Logger; }
 	private:
@@ -18,9 +43,43 @@ namespace GLCore {
 
 }
 
+// Levels below GLCORE_ACTIVE_LOG_LEVEL (an SPDLOG_LEVEL_* value) compile to
+// nothing, arguments included
+#ifndef GLCORE_ACTIVE_LOG_LEVEL
+	#ifdef GLCORE_RELEASE
+		#define GLCORE_ACTIVE_LOG_LEVEL SPDLOG_LEVEL_INFO
+	#else
+		#define GLCORE_ACTIVE_LOG_LEVEL SPDLOG_LEVEL_TRACE
+	#endif
+#endif
+
 // Client log macros
-#define LOG_TRACE(...)         ::GLCore::Log::GetLogger()->trace(__VA_ARGS__)
-#define LOG_INFO(...)          ::GLCore::Log::GetLogger()->info(__VA_ARGS__)
-#define LOG_WARN(...)          ::GLCore::Log::GetLogger()->warn(__VA_ARGS__)
-#define LOG_ERROR(...)         ::GLCore::Log::GetLogger()->error(__VA_ARGS__)
-#define LOG_CRITICAL(...)      ::GLCore::Log::GetLogger()->critical(__VA_ARGS__)
+#if GLCORE_ACTIVE_LOG_LEVEL <= SPDLOG_LEVEL_TRACE
+	#define LOG_TRACE(...)         ::GLCore::Log::GetLogger()->trace(__VA_ARGS__)
+#else
+	#define LOG_TRACE(...)         (void)0
+#endif
+
+#if GLCORE_ACTIVE_LOG_LEVEL <= SPDLOG_LEVEL_INFO
+	#define LOG_INFO(...)          ::GLCore::Log::GetLogger()->info(__VA_ARGS__)
+#else
+	#define LOG_INFO(...)          (void)0
+#endif
+
+#if GLCORE_ACTIVE_LOG_LEVEL <= SPDLOG_LEVEL_WARN
+	#define LOG_WARN(...)          ::GLCore::Log::GetLogger()->warn(__VA_ARGS__)
+#else
+	#define LOG_WARN(...)          (void)0
+#endif
+
+#if GLCORE_ACTIVE_LOG_LEVEL <= SPDLOG_LEVEL_ERROR
+	#define LOG_ERROR(...)         ::GLCore::Log::GetLogger()->error(__VA_ARGS__)
+#else
+	#define LOG_ERROR(...)         (void)0
+#endif
+
+#if GLCORE_ACTIVE_LOG_LEVEL <= SPDLOG_LEVEL_CRITICAL
+	#define LOG_CRITICAL(...)      ::GLCore::Log::GetLogger()->critical(__VA_ARGS__)
+#else
+	#define LOG_CRITICAL(...)      (void)0
+#endif
@@ -0,0 +1,19 @@
+#include "glpch.h"
+
+// spdlog and its bundled fmt are compiled once here instead of in every
+// translation unit that logs (SPDLOG_COMPILED_LIB is defined project-wide)
+#include "../../../vendor/spdlog/src/spdlog.cpp"
+#include "../../../vendor/spdlog/src/stdout_sinks.cpp"
+#include "../../../vendor/spdlog/src/color_sinks.cpp"
+#include "../../../vendor/spdlog/src/file_sinks.cpp"
+#include "../../../vendor/spdlog/src/async.cpp"
+
+#if __has_include("../../../vendor/spdlog/src/cfg.cpp")
+	#include "../../../vendor/spdlog/src/cfg.cpp"
+#endif
+
+#if __has_include("../../../vendor/spdlog/src/bundled_fmtlib_format.cpp")
+	#include "../../../vendor/spdlog/src/bundled_fmtlib_format.cpp"
+#elif __has_include("../../../vendor/spdlog/src/fmt.cpp")
+	#include "../../../vendor/spdlog/src/fmt.cpp"
+#endif
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Core.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace GLCore {
+
+	// Bounded lock-free multi-producer/multi-consumer ring (Dmitry Vyukov's
+	// design). Every cell carries a sequence number that tells producers and
+	// consumers whether it is free for the current lap, so neither side ever
+	// takes a lock. Elements are written and read in place through callbacks
+	// so slots (and any capacity they hold) are reused.
+	template<typename T>
+	class MPMCQueue
+	{
+	public:
+		MPMCQueue(size_t capacity)
+			: m_Mask(capacity - 1), m_Cells(std::make_unique<Cell[]>(capacity))
+		{
+			GLCORE_ASSERT(capacity >= 2 && (capacity & m_Mask) == 0, "MPMCQueue capacity must be a power of two");
+			for (size_t i = 0; i < capacity; i++)
+				m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+
+		MPMCQueue(const MPMCQueue&) = delete;
+		MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+		// writer(T&) fills the slot; returns false when the queue is full
+		template<typename F>
+		bool TryPush(F&& writer)
+		{
+			Cell* cell;
+			size_t position = m_PushPosition.load(std::memory_order_relaxed);
+			while (true)
+			{
+				cell = &m_Cells[position & m_Mask];
+				size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+				intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+				if (difference == 0)
+				{
+					if (m_PushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = m_PushPosition.load(std::memory_order_relaxed);
+				}
+			}
+
+			writer(cell->Data);
+			cell->Sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		// reader(T&) consumes the slot; returns false when the queue is empty
+		template<typename F>
+		bool TryPop(F&& reader)
+		{
+			Cell* cell;
+			size_t position = m_PopPosition.load(std::memory_order_relaxed);
+			while (true)
+			{
+				cell = &m_Cells[position & m_Mask];
+				size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+				intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+				if (difference == 0)
+				{
+					if (m_PopPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = m_PopPosition.load(std::memory_order_relaxed);
+				}
+			}
+
+			reader(cell->Data);
+			cell->Sequence.store(position + m_Mask + 1, std::memory_order_release);
+			return true;
+		}
+
+		size_t Capacity() const { return m_Mask + 1; }
+
+		size_t SizeApprox() const
+		{
+			size_t push = m_PushPosition.load(std::memory_order_relaxed);
+			size_t pop = m_PopPosition.load(std::memory_order_relaxed);
+			return push > pop ? push - pop : 0;
+		}
+	private:
+		struct Cell
+		{
+			std::atomic<size_t> Sequence;
+			T Data;
+		};
+
+		size_t m_Mask;
+		std::unique_ptr<Cell[]> m_Cells;
+		alignas(64) std::atomic<size_t> m_PushPosition = 0;
+		alignas(64) std::atomic<size_t> m_PopPosition = 0;
+	};
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace GLCore {
+
+	// Read-only memory mapping of a whole file. Pages are faulted in on
+	// first access, so a mapped file can be handed straight to an upload
+	// without being read into an intermediate buffer.
+	// Implemented per platform in Platform/<OS>/<OS>MappedFile.cpp.
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		explicit MappedFile(const std::string& filepath) { Open(filepath); }
+		~MappedFile() { Close(); }
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		MappedFile(MappedFile&& other) noexcept
+			: m_Data(other.m_Data), m_Size(other.m_Size)
+		{
+			other.m_Data = nullptr;
+			other.m_Size = 0;
+		}
+
+		MappedFile& operator=(MappedFile&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Close();
+				std::swap(m_Data, other.m_Data);
+				std::swap(m_Size, other.m_Size);
+			}
+			return *this;
+		}
+
+		// Logs and returns false if the file cannot be opened or is empty
+		bool Open(const std::string& filepath);
+		void Close();
+
+		bool IsOpen() const { return m_Data != nullptr; }
+		const uint8_t* GetData() const { return m_Data; }
+		size_t GetSize() const { return m_Size; }
+	private:
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+	};
+
+}
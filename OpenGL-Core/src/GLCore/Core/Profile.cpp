@@ -0,0 +1,86 @@
+#include "glpch.h"
+#include "Profile.h"
+
+#ifdef GLCORE_PROFILE
+
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace GLCore {
+
+	using Clock = std::chrono::steady_clock;
+
+	// Checked without the lock so that scopes outside a session stay cheap
+	static std::atomic<bool> s_SessionActive = false;
+	static std::mutex s_SessionMutex;
+	static std::ofstream s_Output;
+	static Clock::time_point s_SessionStart;
+	static bool s_FirstEvent = true;
+
+	bool Profiler::BeginSession(const std::string& filepath)
+	{
+		std::scoped_lock<std::mutex> lock(s_SessionMutex);
+		if (s_Output.is_open())
+		{
+			LOG_ERROR("Profiler session already open, ignoring {0}", filepath);
+			return false;
+		}
+
+		s_Output.open(filepath, std::ios::out | std::ios::trunc);
+		if (!s_Output)
+		{
+			LOG_ERROR("Could not open profiler output {0}", filepath);
+			return false;
+		}
+
+		s_Output << "{\"otherData\":{},\"traceEvents\":[";
+		s_Output.setf(std::ios::fixed);
+		s_Output.precision(3);
+		s_SessionStart = Clock::now();
+		s_FirstEvent = true;
+		s_SessionActive = true;
+		return true;
+	}
+
+	void Profiler::EndSession()
+	{
+		std::scoped_lock<std::mutex> lock(s_SessionMutex);
+		if (!s_Output.is_open())
+			return;
+
+		s_SessionActive = false;
+		s_Output << "\n]}\n";
+		s_Output.close();
+	}
+
+	void Profiler::WriteScope(const char* name, Clock::time_point start, Clock::time_point end)
+	{
+		if (!s_SessionActive.load(std::memory_order_relaxed))
+			return;
+
+		using Microseconds = std::chrono::duration<double, std::micro>;
+		size_t threadID = std::hash<std::thread::id>()(std::this_thread::get_id());
+
+		std::scoped_lock<std::mutex> lock(s_SessionMutex);
+		if (!s_Output.is_open())
+			return;
+
+		s_Output << (s_FirstEvent ? "\n" : ",\n") << "{\"name\":\"";
+		for (const char* c = name; *c; c++)
+		{
+			if (*c == '"' || *c == '\\')
+				s_Output << '\\';
+			s_Output << *c;
+		}
+		s_Output << "\",\"cat\":\"GLCore\",\"ph\":\"X\",\"pid\":0,\"tid\":" << threadID
+			<< ",\"ts\":" << Microseconds(start - s_SessionStart).count()
+			<< ",\"dur\":" << Microseconds(end - start).count() << "}";
+		s_FirstEvent = false;
+	}
+
+}
+
+#endif
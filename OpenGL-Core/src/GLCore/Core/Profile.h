@@ -0,0 +1,63 @@
+#pragma once
+
+// CPU timing scopes for the Profile configuration, written as Chrome trace
+// events (open the file in chrome://tracing or ui.perfetto.dev). Without
+// GLCORE_PROFILE the macros compile to nothing.
+
+#ifdef GLCORE_PROFILE
+
+#include <chrono>
+#include <string>
+
+namespace GLCore {
+
+	class Profiler
+	{
+	public:
+		// Scopes are only recorded between BeginSession and EndSession
+		static bool BeginSession(const std::string& filepath);
+		static void EndSession();
+
+		// Safe to call from any thread
+		static void WriteScope(const char* name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+	};
+
+	// The name is not copied and must outlive the scope
+	class ProfileScope
+	{
+	public:
+		ProfileScope(const char* name)
+			: m_Name(name), m_Start(std::chrono::steady_clock::now())
+		{
+		}
+
+		~ProfileScope()
+		{
+			Profiler::WriteScope(m_Name, m_Start, std::chrono::steady_clock::now());
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+	private:
+		const char* m_Name;
+		std::chrono::steady_clock::time_point m_Start;
+	};
+
+}
+
+#define GLCORE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define GLCORE_PROFILE_CONCAT(a, b) GLCORE_PROFILE_CONCAT_IMPL(a, b)
+
+#define GLCORE_PROFILE_BEGIN_SESSION(filepath) ::GLCore::Profiler::BeginSession(filepath)
+#define GLCORE_PROFILE_END_SESSION()           ::GLCore::Profiler::EndSession()
+#define GLCORE_PROFILE_SCOPE(name)             ::GLCore::ProfileScope GLCORE_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define GLCORE_PROFILE_FUNCTION()              GLCORE_PROFILE_SCOPE(__func__)
+
+#else
+
+#define GLCORE_PROFILE_BEGIN_SESSION(filepath) ((void)0)
+#define GLCORE_PROFILE_END_SESSION()           ((void)0)
+#define GLCORE_PROFILE_SCOPE(name)             ((void)0)
+#define GLCORE_PROFILE_FUNCTION()              ((void)0)
+
+#endif
@@ -0,0 +1,26 @@
+#include "glpch.h"
+#include "Window.h"
+
+#if defined(GLCORE_PLATFORM_WINDOWS) || defined(GLCORE_PLATFORM_LINUX)
+	#include "Platform/GLFW/GlfwWindow.h"
+#endif
+
+namespace GLCore {
+
+	Window* Window::Create(const WindowProps& props)
+	{
+	#if defined(GLCORE_PLATFORM_WINDOWS) || defined(GLCORE_PLATFORM_LINUX)
+		GlfwWindow* window = new GlfwWindow(props);
+		if (!window->GetNativeWindow())
+		{
+			delete window;
+			return nullptr;
+		}
+		return window;
+	#else
+		GLCORE_ASSERT(false, "Unknown platform!");
+		return nullptr;
+	#endif
+	}
+
+}
@@ -1,10 +1,11 @@
 #pragma once
 
-#include "glpch.h"
-
 #include "GLCore/Core/Core.h"
 #include "GLCore/Events/Event.h"
 
+#include <functional>
+#include <string>
+
 namespace GLCore {
 
 	struct WindowProps
@@ -12,11 +13,14 @@ namespace GLCore {
 		std::string Title;
 		uint32_t Width;
 		uint32_t Height;
+		// Hidden windows still own a GL context (e.g. for headless runs)
+		bool Visible;
 
 		WindowProps(const std::string& title = "OpenGL Sandbox",
 			        uint32_t width = 1280,
-			        uint32_t height = 720)
-			: Title(title), Width(width), Height(height)
+			        uint32_t height = 720,
+			        bool visible = true)
+			: Title(title), Width(width), Height(height), Visible(visible)
 		{
 		}
 	};
@@ -29,7 +33,16 @@ namespace GLCore {
 
 		virtual ~Window() = default;
 
+		// PollEvents() followed by SwapBuffers()
 		virtual void OnUpdate() = 0;
+		virtual void PollEvents() = 0;
+		// Sleeps until an event arrives or timeout seconds pass, then
+		// processes events like PollEvents()
+		virtual void WaitEvents(double timeout) = 0;
+		// Wakes a WaitEvents() call; safe to call from any thread
+		virtual void PostEmptyEvent() = 0;
+		// Must be called on the thread that owns the GL context
+		virtual void SwapBuffers() = 0;
 
 		virtual uint32_t GetWidth() const = 0;
 		virtual uint32_t GetHeight() const = 0;
@@ -41,6 +54,8 @@ namespace GLCore {
 
 		virtual void* GetNativeWindow() const = 0;
 
+		// Returns nullptr if the window or its OpenGL context could not be
+		// created; the reason is logged
 		static Window* Create(const WindowProps& props = WindowProps());
 	};
 
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Core.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace GLCore {
+
+	// Fixed-capacity Chase-Lev deque (Le, Pop, Cohen, Zappa Nardelli 2013).
+	// Only the owning thread may Push/Pop (LIFO end), any thread may Steal
+	// (FIFO end). Stores pointers; nullptr means "empty or lost a race".
+	template<typename T>
+	class WorkStealingDeque
+	{
+	public:
+		WorkStealingDeque(uint32_t capacity = 4096)
+			: m_Capacity(capacity), m_Mask(capacity - 1), m_Buffer(std::make_unique<std::atomic<T*>[]>(capacity))
+		{
+			GLCORE_ASSERT((capacity & m_Mask) == 0, "WorkStealingDeque capacity must be a power of two");
+		}
+
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+		// Returns false when the deque is full; the caller should run the item inline
+		bool Push(T* item)
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			if (bottom - top >= (int64_t)m_Capacity)
+				return false;
+
+			m_Buffer[bottom & m_Mask].store(item, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		T* Pop()
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				// Empty
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			T* item = m_Buffer[bottom & m_Mask].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// Last item, race against thieves for it
+				if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					item = nullptr;
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			return item;
+		}
+
+		T* Steal()
+		{
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return nullptr;
+
+			T* item = m_Buffer[top & m_Mask].load(std::memory_order_relaxed);
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+			return item;
+		}
+
+		size_t SizeApprox() const
+		{
+			int64_t size = m_Bottom.load(std::memory_order_relaxed) - m_Top.load(std::memory_order_relaxed);
+			return size > 0 ? (size_t)size : 0;
+		}
+	private:
+		// Keep the thief-side and owner-side indices on separate cache lines
+		alignas(64) std::atomic<int64_t> m_Top = 0;
+		alignas(64) std::atomic<int64_t> m_Bottom = 0;
+		uint32_t m_Capacity;
+		uint32_t m_Mask;
+		std::unique_ptr<std::atomic<T*>[]> m_Buffer;
+	};
+
+}
@@ -0,0 +1,57 @@
+#include "glpch.h"
+#include "Event.h"
+
+#include "ApplicationEvent.h"
+#include "KeyEvent.h"
+#include "MouseEvent.h"
+
+#include <ostream>
+
+namespace GLCore {
+
+	std::ostream& operator<<(std::ostream& os, const Event& e)
+	{
+		return os << e.ToString();
+	}
+
+	std::string WindowResizeEvent::ToString() const
+	{
+		return fmt::format("WindowResizeEvent: {0}, {1}", m_Width, m_Height);
+	}
+
+	std::string KeyPressedEvent::ToString() const
+	{
+		return fmt::format("KeyPressedEvent: {0} ({1} repeats)", m_KeyCode, m_RepeatCount);
+	}
+
+	std::string KeyReleasedEvent::ToString() const
+	{
+		return fmt::format("KeyReleasedEvent: {0}", m_KeyCode);
+	}
+
+	std::string KeyTypedEvent::ToString() const
+	{
+		return fmt::format("KeyTypedEvent: {0}", m_KeyCode);
+	}
+
+	std::string MouseMovedEvent::ToString() const
+	{
+		return fmt::format("MouseMovedEvent: {0}, {1}", m_MouseX, m_MouseY);
+	}
+
+	std::string MouseScrolledEvent::ToString() const
+	{
+		return fmt::format("MouseScrolledEvent: {0}, {1}", GetXOffset(), GetYOffset());
+	}
+
+	std::string MouseButtonPressedEvent::ToString() const
+	{
+		return fmt::format("MouseButtonPressedEvent: {0}", m_Button);
+	}
+
+	std::string MouseButtonReleasedEvent::ToString() const
+	{
+		return fmt::format("MouseButtonReleasedEvent: {0}", m_Button);
+	}
+
+}
@@ -1,8 +1,10 @@
 #pragma once
 
-#include "glpch.h"
 #include "../Core/Core.h"
 
+#include <iosfwd>
+#include <string>
+
 namespace GLCore {
 
 	// Events in Hazel are currently blocking, meaning when an event occurs it
@@ -29,7 +31,7 @@ namespace GLCore {
 		EventCategoryMouseButton    = BIT(4)
 	};
 
-#define EVENT_CLASS_TYPE(type) static EventType GetStaticType() { return EventType::##type; }\
+#define EVENT_CLASS_TYPE(type) static EventType GetStaticType() { return EventType::type; }\
 								virtual EventType GetEventType() const override { return GetStaticType(); }\
 								virtual const char* GetName() const override { return #type; }
 
@@ -43,6 +45,7 @@ namespace GLCore {
 		virtual EventType GetEventType() const = 0;
 		virtual const char* GetName() const = 0;
 		virtual int GetCategoryFlags() const = 0;
+		// For logging; the overrides are in Event.cpp
 		virtual std::string ToString() const { return GetName(); }
 
 		inline bool IsInCategory(EventCategory category)
@@ -74,10 +77,7 @@ namespace GLCore {
 		Event& m_Event;
 	};
 
-	inline std::ostream& operator<<(std::ostream& os, const Event& e)
-	{
-		return os << e.ToString();
-	}
+	std::ostream& operator<<(std::ostream& os, const Event& e);
 
 }
 
@@ -0,0 +1,365 @@
+#include "glpch.h"
+#include "EventRecorder.h"
+
+#include "ApplicationEvent.h"
+#include "KeyEvent.h"
+#include "MouseEvent.h"
+
+#include <fstream>
+
+namespace GLCore {
+
+	static const char s_EventFileMagic[4] = { 'G', 'L', 'E', 'R' };
+	// Version 2 widened the per-frame event count from 16 to 32 bits;
+	// version 1 recordings still load
+	static const uint32_t s_EventFileVersion = 2;
+
+	template<typename T>
+	static void Write(std::ofstream& stream, T value)
+	{
+		stream.write((const char*)&value, sizeof(T));
+	}
+
+	template<typename T>
+	static bool Read(std::ifstream& stream, T& value)
+	{
+		return (bool)stream.read((char*)&value, sizeof(T));
+	}
+
+	EventRecorder::EventRecorder() = default;
+
+	EventRecorder::~EventRecorder()
+	{
+		Close();
+	}
+
+	bool EventRecorder::Open(const std::string& filepath)
+	{
+		Close();
+
+		auto stream = std::make_unique<std::ofstream>(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!*stream)
+		{
+			LOG_ERROR("Could not open event recording '{0}'", filepath);
+			return false;
+		}
+
+		stream->write(s_EventFileMagic, sizeof(s_EventFileMagic));
+		Write(*stream, s_EventFileVersion);
+		m_Stream = std::move(stream);
+		m_PendingEvents.clear();
+		m_FrameCount = 0;
+		return true;
+	}
+
+	void EventRecorder::Close()
+	{
+		if (m_Stream)
+		{
+			LOG_INFO("Recorded {0} frames", m_FrameCount);
+			m_Stream.reset();
+		}
+	}
+
+	void EventRecorder::RecordEvent(const Event& e)
+	{
+		RecordedEvent recorded;
+		recorded.Type = e.GetEventType();
+
+		switch (recorded.Type)
+		{
+			case EventType::KeyPressed:
+			{
+				auto& event = (const KeyPressedEvent&)e;
+				recorded.Code = event.GetKeyCode();
+				recorded.Repeat = event.GetRepeatCount();
+				break;
+			}
+			case EventType::KeyReleased:
+			case EventType::KeyTyped:
+				recorded.Code = ((const KeyEvent&)e).GetKeyCode();
+				break;
+			case EventType::MouseButtonPressed:
+			case EventType::MouseButtonReleased:
+				recorded.Code = ((const MouseButtonEvent&)e).GetMouseButton();
+				break;
+			case EventType::MouseMoved:
+				recorded.X = ((const MouseMovedEvent&)e).GetX();
+				recorded.Y = ((const MouseMovedEvent&)e).GetY();
+				break;
+			case EventType::MouseScrolled:
+				recorded.X = ((const MouseScrolledEvent&)e).GetXOffset();
+				recorded.Y = ((const MouseScrolledEvent&)e).GetYOffset();
+				break;
+			case EventType::WindowResize:
+				recorded.Code = (int32_t)((const WindowResizeEvent&)e).GetWidth();
+				recorded.Repeat = (int32_t)((const WindowResizeEvent&)e).GetHeight();
+				break;
+			default:
+				return;
+		}
+
+		m_PendingEvents.push_back(recorded);
+	}
+
+	void EventRecorder::RecordFrame(float timestep)
+	{
+		if (!m_Stream)
+			return;
+
+		std::ofstream& stream = *m_Stream;
+
+		if (m_PendingEvents.size() > 0xFFFFFFFF)
+		{
+			LOG_ERROR("Dropping {0} events over the per-frame limit of the recording", m_PendingEvents.size() - 0xFFFFFFFF);
+			m_PendingEvents.resize(0xFFFFFFFF);
+		}
+
+		Write(stream, timestep);
+		Write(stream, (uint32_t)m_PendingEvents.size());
+		for (const RecordedEvent& recorded : m_PendingEvents)
+		{
+			Write(stream, (uint8_t)recorded.Type);
+			switch (recorded.Type)
+			{
+				case EventType::KeyPressed:
+					Write(stream, recorded.Code);
+					Write(stream, (uint16_t)recorded.Repeat);
+					break;
+				case EventType::KeyReleased:
+				case EventType::KeyTyped:
+					Write(stream, recorded.Code);
+					break;
+				case EventType::MouseButtonPressed:
+				case EventType::MouseButtonReleased:
+					Write(stream, (uint8_t)recorded.Code);
+					break;
+				case EventType::MouseMoved:
+				case EventType::MouseScrolled:
+					Write(stream, recorded.X);
+					Write(stream, recorded.Y);
+					break;
+				case EventType::WindowResize:
+					Write(stream, (uint32_t)recorded.Code);
+					Write(stream, (uint32_t)recorded.Repeat);
+					break;
+				default:
+					break;
+			}
+		}
+
+		m_PendingEvents.clear();
+		m_FrameCount++;
+	}
+
+	bool EventReplay::Load(const std::string& filepath)
+	{
+		m_Frames.clear();
+
+		std::ifstream stream(filepath, std::ios::in | std::ios::binary);
+		if (!stream)
+		{
+			LOG_ERROR("Could not open event recording '{0}'", filepath);
+			return false;
+		}
+
+		char magic[4];
+		uint32_t version;
+		if (!stream.read(magic, sizeof(magic)) || memcmp(magic, s_EventFileMagic, sizeof(magic)) != 0 || !Read(stream, version) || version < 1 || version > s_EventFileVersion)
+		{
+			LOG_ERROR("'{0}' is not a supported event recording", filepath);
+			return false;
+		}
+
+		std::streamoff dataStart = stream.tellg();
+		stream.seekg(0, std::ios::end);
+		std::streamoff fileSize = stream.tellg();
+		stream.seekg(dataStart);
+
+		auto readEventCount = [&](uint32_t& count)
+		{
+			if (version >= 2)
+				return Read(stream, count);
+
+			uint16_t count16;
+			bool valid = Read(stream, count16);
+			count = count16;
+			return valid;
+		};
+
+		RecordedFrame frame;
+		uint32_t eventCount;
+		while (Read(stream, frame.Timestep) && readEventCount(eventCount))
+		{
+			// Every event takes at least two bytes; a larger count is corrupt
+			// and must not size the allocation
+			if ((uint64_t)eventCount * 2 > (uint64_t)(fileSize - stream.tellg()))
+			{
+				LOG_ERROR("Event recording '{0}' is corrupt after frame {1}", filepath, m_Frames.size());
+				return false;
+			}
+
+			frame.Events.resize(eventCount);
+			for (RecordedEvent& recorded : frame.Events)
+			{
+				recorded = RecordedEvent();
+
+				uint8_t type = 0;
+				bool valid = Read(stream, type);
+				recorded.Type = (EventType)type;
+				switch (recorded.Type)
+				{
+					case EventType::KeyPressed:
+					{
+						int32_t code;
+						uint16_t repeat;
+						valid = valid && Read(stream, code) && Read(stream, repeat);
+						recorded.Code = code;
+						recorded.Repeat = repeat;
+						break;
+					}
+					case EventType::KeyReleased:
+					case EventType::KeyTyped:
+					{
+						int32_t code;
+						valid = valid && Read(stream, code);
+						recorded.Code = code;
+						break;
+					}
+					case EventType::MouseButtonPressed:
+					case EventType::MouseButtonReleased:
+					{
+						uint8_t button;
+						valid = valid && Read(stream, button);
+						recorded.Code = button;
+						break;
+					}
+					case EventType::MouseMoved:
+					case EventType::MouseScrolled:
+						valid = valid && Read(stream, recorded.X) && Read(stream, recorded.Y);
+						break;
+					case EventType::WindowResize:
+					{
+						uint32_t width, height;
+						valid = valid && Read(stream, width) && Read(stream, height);
+						recorded.Code = (int32_t)width;
+						recorded.Repeat = (int32_t)height;
+						break;
+					}
+					default:
+						valid = false;
+						break;
+				}
+
+				if (!valid)
+				{
+					LOG_ERROR("Event recording '{0}' is corrupt after frame {1}", filepath, m_Frames.size());
+					return false;
+				}
+			}
+
+			m_Frames.push_back(frame);
+		}
+
+		return true;
+	}
+
+	void EventReplay::Dispatch(const RecordedEvent& recorded, const std::function<void(Event&)>& callback)
+	{
+		switch (recorded.Type)
+		{
+			case EventType::KeyPressed:          { KeyPressedEvent event(recorded.Code, recorded.Repeat); callback(event); break; }
+			case EventType::KeyReleased:         { KeyReleasedEvent event(recorded.Code); callback(event); break; }
+			case EventType::KeyTyped:            { KeyTypedEvent event(recorded.Code); callback(event); break; }
+			case EventType::MouseButtonPressed:  { MouseButtonPressedEvent event(recorded.Code); callback(event); break; }
+			case EventType::MouseButtonReleased: { MouseButtonReleasedEvent event(recorded.Code); callback(event); break; }
+			case EventType::MouseMoved:          { MouseMovedEvent event(recorded.X, recorded.Y); callback(event); break; }
+			case EventType::MouseScrolled:       { MouseScrolledEvent event(recorded.X, recorded.Y); callback(event); break; }
+			case EventType::WindowResize:        { WindowResizeEvent event((uint32_t)recorded.Code, (uint32_t)recorded.Repeat); callback(event); break; }
+			default: break;
+		}
+	}
+
+	static float Percentile(std::vector<float> values, float percentile)
+	{
+		if (values.empty())
+			return 0.0f;
+
+		size_t index = std::min(values.size() - 1, (size_t)(percentile * (float)values.size()));
+		std::nth_element(values.begin(), values.begin() + index, values.end());
+		return values[index];
+	}
+
+	static float Mean(const std::vector<float>& values)
+	{
+		double sum = 0.0;
+		for (float value : values)
+			sum += value;
+		return values.empty() ? 0.0f : (float)(sum / values.size());
+	}
+
+	void EventReplay::ReportFrameTimes(const std::vector<float>& frameTimes, const std::string& outputPath, const std::string& baselinePath)
+	{
+		LOG_INFO("Replayed {0} frames: mean {1:.3f}ms, p50 {2:.3f}ms, p95 {3:.3f}ms, p99 {4:.3f}ms, max {5:.3f}ms",
+			frameTimes.size(), Mean(frameTimes), Percentile(frameTimes, 0.5f), Percentile(frameTimes, 0.95f),
+			Percentile(frameTimes, 0.99f), Percentile(frameTimes, 1.0f));
+
+		std::vector<float> baseline;
+		if (!baselinePath.empty())
+		{
+			std::ifstream stream(baselinePath);
+			if (!stream)
+				LOG_ERROR("Could not open baseline frame times '{0}'", baselinePath);
+
+			std::string line;
+			while (std::getline(stream, line))
+			{
+				uint32_t frame;
+				float milliseconds;
+				if (sscanf(line.c_str(), "%u,%f", &frame, &milliseconds) == 2)
+					baseline.push_back(milliseconds);
+			}
+
+			if (baseline.size() != frameTimes.size())
+				LOG_WARN("Baseline has {0} frames, this replay has {1}", baseline.size(), frameTimes.size());
+		}
+
+		size_t compared = std::min(baseline.size(), frameTimes.size());
+		if (compared > 0)
+		{
+			std::vector<float> differences(compared);
+			size_t slowestFrame = 0;
+			for (size_t i = 0; i < compared; i++)
+			{
+				differences[i] = frameTimes[i] - baseline[i];
+				if (differences[i] > differences[slowestFrame])
+					slowestFrame = i;
+			}
+
+			std::vector<float> baselineTimes(baseline.begin(), baseline.begin() + compared);
+			LOG_INFO("Against baseline: mean {0:+.3f}ms, p95 {1:+.3f}ms, largest regression {2:+.3f}ms at frame {3}",
+				Mean(differences), Percentile(frameTimes, 0.95f) - Percentile(baselineTimes, 0.95f),
+				differences[slowestFrame], slowestFrame);
+		}
+
+		if (outputPath.empty())
+			return;
+
+		std::ofstream stream(outputPath);
+		if (!stream)
+		{
+			LOG_ERROR("Could not write frame times to '{0}'", outputPath);
+			return;
+		}
+
+		stream << (compared > 0 ? "frame,ms,baseline_ms,diff_ms\n" : "frame,ms\n");
+		for (size_t i = 0; i < frameTimes.size(); i++)
+		{
+			stream << i << ',' << frameTimes[i];
+			if (i < compared)
+				stream << ',' << baseline[i] << ',' << frameTimes[i] - baseline[i];
+			stream << '\n';
+		}
+	}
+
+}
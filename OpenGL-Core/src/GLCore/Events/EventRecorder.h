@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Event.h"
+
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <vector>
+
+namespace GLCore {
+
+	// Compact binary event log:
+	//   header: "GLER" u32 version
+	//   frame:  f32 timestep, u16 event count, events
+	//   event:  u8 EventType, type specific payload (see EventRecorder.cpp)
+	// Only input events and window resizes are recorded.
+
+	struct RecordedEvent
+	{
+		EventType Type = EventType::None;
+		int32_t Code = 0, Repeat = 0;
+		float X = 0.0f, Y = 0.0f;
+	};
+
+	struct RecordedFrame
+	{
+		float Timestep = 0.0f;
+		std::vector<RecordedEvent> Events;
+	};
+
+	class EventRecorder
+	{
+	public:
+		EventRecorder();
+		~EventRecorder();
+
+		bool Open(const std::string& filepath);
+		void Close();
+		bool IsRecording() const { return m_Stream != nullptr; }
+
+		// Events are buffered until the frame they are consumed by is recorded
+		void RecordEvent(const Event& e);
+		void RecordFrame(float timestep);
+
+		uint32_t GetFrameCount() const { return m_FrameCount; }
+	private:
+		std::unique_ptr<std::ofstream> m_Stream;
+		std::vector<RecordedEvent> m_PendingEvents;
+		uint32_t m_FrameCount = 0;
+	};
+
+	class EventReplay
+	{
+	public:
+		bool Load(const std::string& filepath);
+
+		const std::vector<RecordedFrame>& GetFrames() const { return m_Frames; }
+		uint32_t GetFrameCount() const { return (uint32_t)m_Frames.size(); }
+
+		// Rebuilds the recorded event and passes it to callback
+		static void Dispatch(const RecordedEvent& recorded, const std::function<void(Event&)>& callback);
+
+		// Logs a summary of the replayed frame times (in milliseconds) and, if
+		// outputPath is set, writes them as "frame,ms" CSV. A CSV written by an
+		// earlier replay of the same recording can be passed as baselinePath to
+		// add per-frame differences.
+		static void ReportFrameTimes(const std::vector<float>& frameTimes, const std::string& outputPath, const std::string& baselinePath);
+	private:
+		std::vector<RecordedFrame> m_Frames;
+	};
+
+}
@@ -25,12 +25,7 @@ namespace GLCore {
 
 		inline int GetRepeatCount() const { return m_RepeatCount; }
 
-		std::string ToString() const override
-		{
-			std::stringstream ss;
-			ss << "KeyPressedEvent: " << m_KeyCode << " (" << m_RepeatCount << " repeats)";
-			return ss.str();
-		}
+		std::string ToString() const override;
 
 		EVENT_CLASS_TYPE(KeyPressed)
 	private:
@@ -43,12 +38,7 @@ namespace GLCore {
 		KeyReleasedEvent(int keycode)
 			: KeyEvent(keycode) {}
 
-		std::string ToString() const override
-		{
-			std::stringstream ss;
-			ss << "KeyReleasedEvent: " << m_KeyCode;
-			return ss.str();
-		}
+		std::string ToString() const override;
 
 		EVENT_CLASS_TYPE(KeyReleased)
 	};
@@ -59,12 +49,7 @@ namespace GLCore {
 		KeyTypedEvent(int keycode)
 			: KeyEvent(keycode) {}
 
-		std::string ToString() const override
-		{
-			std::stringstream ss;
-			ss << "KeyTypedEvent: " << m_KeyCode;
-			return ss.str();
-		}
+		std::string ToString() const override;
 
 		EVENT_CLASS_TYPE(KeyTyped)
 	};
@@ -0,0 +1,235 @@
+#include "glpch.h"
+#include "FileSystem.h"
+
+#include "PackedArchive.h"
+#include "GLCore/Core/MappedFile.h"
+
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+
+namespace GLCore {
+
+	namespace fs = std::filesystem;
+
+	struct MountPoint
+	{
+		std::string Point; // Normalized, "" for the root
+		std::string Directory;
+		std::unique_ptr<PackedArchive> Archive;
+	};
+
+	// Where a path resolved to: an archive entry or a loose file
+	struct ResolvedFile
+	{
+		const PackedArchive* Archive = nullptr;
+		const PackedArchiveEntry* Entry = nullptr;
+		std::string PhysicalPath;
+	};
+
+	struct FileSystemData
+	{
+		std::shared_mutex Mutex;
+		std::vector<MountPoint> Mounts; // Most recent last
+	};
+
+	static FileSystemData& GetData()
+	{
+		static FileSystemData s_Data;
+		return s_Data;
+	}
+
+	static bool IsLooseFile(const std::string& physicalPath)
+	{
+		std::error_code error;
+		return fs::is_regular_file(physicalPath, error);
+	}
+
+	// Caller holds the mutex, shared at least
+	static bool Resolve(const std::string& path, ResolvedFile& outFile)
+	{
+		std::string normalizedPath = FileSystem::NormalizePath(path);
+
+		// Absolute paths bypass the mounts
+		if (!fs::path(normalizedPath).has_root_path())
+		{
+			const std::vector<MountPoint>& mounts = GetData().Mounts;
+			for (auto it = mounts.rbegin(); it != mounts.rend(); ++it)
+			{
+				std::string_view relativePath = normalizedPath;
+				if (!it->Point.empty())
+				{
+					if (relativePath.size() <= it->Point.size() || relativePath.compare(0, it->Point.size(), it->Point) != 0
+						|| relativePath[it->Point.size()] != '/')
+						continue;
+					relativePath.remove_prefix(it->Point.size() + 1);
+				}
+
+				if (it->Archive)
+				{
+					if (const PackedArchiveEntry* entry = it->Archive->Find(relativePath))
+					{
+						outFile.Archive = it->Archive.get();
+						outFile.Entry = entry;
+						return true;
+					}
+				}
+				else
+				{
+					std::string physicalPath = (fs::path(it->Directory) / relativePath).generic_string();
+					if (IsLooseFile(physicalPath))
+					{
+						outFile.PhysicalPath = std::move(physicalPath);
+						return true;
+					}
+				}
+			}
+		}
+
+		if (!IsLooseFile(normalizedPath))
+			return false;
+
+		outFile.PhysicalPath = std::move(normalizedPath);
+		return true;
+	}
+
+	bool FileSystem::Mount(const std::string& mountPoint, const std::string& physicalPath)
+	{
+		MountPoint mount;
+		mount.Point = NormalizePath(mountPoint);
+		if (mount.Point == ".")
+			mount.Point.clear();
+
+		std::error_code error;
+		if (fs::is_directory(physicalPath, error))
+		{
+			mount.Directory = physicalPath;
+		}
+		else
+		{
+			mount.Archive = std::make_unique<PackedArchive>();
+			if (!mount.Archive->Open(physicalPath))
+			{
+				LOG_ERROR("Could not mount '{0}' at '{1}'", physicalPath, mountPoint);
+				return false;
+			}
+		}
+
+		LOG_INFO("Mounted '{0}' at '{1}'{2}", physicalPath, mount.Point,
+			mount.Archive ? " (" + std::to_string(mount.Archive->GetEntryCount()) + " files)" : "");
+
+		std::unique_lock<std::shared_mutex> lock(GetData().Mutex);
+		GetData().Mounts.push_back(std::move(mount));
+		return true;
+	}
+
+	void FileSystem::Unmount(const std::string& mountPoint)
+	{
+		std::string point = NormalizePath(mountPoint);
+		if (point == ".")
+			point.clear();
+
+		// FileData already read from an archive keeps its mapping alive
+		std::unique_lock<std::shared_mutex> lock(GetData().Mutex);
+		std::vector<MountPoint>& mounts = GetData().Mounts;
+		mounts.erase(std::remove_if(mounts.begin(), mounts.end(),
+			[&](const MountPoint& mount) { return mount.Point == point; }), mounts.end());
+	}
+
+	void FileSystem::UnmountAll()
+	{
+		std::unique_lock<std::shared_mutex> lock(GetData().Mutex);
+		GetData().Mounts.clear();
+	}
+
+	bool FileSystem::Exists(const std::string& path)
+	{
+		std::shared_lock<std::shared_mutex> lock(GetData().Mutex);
+		ResolvedFile file;
+		return Resolve(path, file);
+	}
+
+	bool FileSystem::Read(const std::string& path, FileData& outData)
+	{
+		outData.Reset();
+
+		std::shared_lock<std::shared_mutex> lock(GetData().Mutex);
+		ResolvedFile file;
+		if (!Resolve(path, file))
+		{
+			LOG_ERROR("Could not open file '{0}'", path);
+			return false;
+		}
+
+		if (file.Archive)
+			return file.Archive->Read(*file.Entry, outData);
+
+		// MappedFile refuses empty files, which are still valid to read
+		std::error_code error;
+		if (fs::file_size(file.PhysicalPath, error) == 0 && !error)
+			return true;
+
+		auto mapping = std::make_shared<MappedFile>();
+		if (!mapping->Open(file.PhysicalPath))
+			return false;
+
+		outData.m_Data = mapping->GetData();
+		outData.m_Size = mapping->GetSize();
+		outData.m_Mapping = std::move(mapping);
+		return true;
+	}
+
+	bool FileSystem::ReadText(const std::string& path, std::string& outText)
+	{
+		FileData data;
+		if (!Read(path, data))
+			return false;
+
+		outText.assign(data.GetText());
+		return true;
+	}
+
+	bool FileSystem::GetPhysicalPath(const std::string& path, std::string& outPhysicalPath)
+	{
+		std::shared_lock<std::shared_mutex> lock(GetData().Mutex);
+		ResolvedFile file;
+		if (!Resolve(path, file) || file.Archive)
+			return false;
+
+		outPhysicalPath = std::move(file.PhysicalPath);
+		return true;
+	}
+
+	bool FileSystem::WriteFileAtomic(const std::string& physicalPath, const void* data, size_t size)
+	{
+		std::string temporaryPath = physicalPath + ".tmp";
+		{
+			std::ofstream out(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!out || !out.write((const char*)data, (std::streamsize)size))
+			{
+				LOG_ERROR("Could not write '{0}'", physicalPath);
+				return false;
+			}
+		}
+
+		std::error_code error;
+		fs::rename(temporaryPath, physicalPath, error);
+		if (error)
+		{
+			LOG_ERROR("Could not write '{0}': {1}", physicalPath, error.message());
+			fs::remove(temporaryPath, error);
+			return false;
+		}
+		return true;
+	}
+
+	std::string FileSystem::NormalizePath(const std::string& path)
+	{
+		std::string result = fs::path(path).lexically_normal().generic_string();
+		if (result.size() > 1 && result.back() == '/')
+			result.pop_back();
+		return result;
+	}
+
+}
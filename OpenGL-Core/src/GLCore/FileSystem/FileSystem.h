@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace GLCore {
+
+	class MappedFile;
+
+	// Contents of one file. Loose files and uncompressed archive entries
+	// point into a shared mapping (no copy); compressed entries own their
+	// decompressed buffer. Move-only.
+	class FileData
+	{
+	public:
+		FileData() = default;
+		FileData(const FileData&) = delete;
+		FileData& operator=(const FileData&) = delete;
+
+		FileData(FileData&& other) noexcept
+			: m_Data(std::exchange(other.m_Data, nullptr)), m_Size(std::exchange(other.m_Size, 0)),
+			m_Mapping(std::move(other.m_Mapping)), m_Buffer(std::move(other.m_Buffer)) {}
+
+		FileData& operator=(FileData&& other) noexcept
+		{
+			m_Data = std::exchange(other.m_Data, nullptr);
+			m_Size = std::exchange(other.m_Size, 0);
+			m_Mapping = std::move(other.m_Mapping);
+			m_Buffer = std::move(other.m_Buffer);
+			return *this;
+		}
+
+		const uint8_t* GetData() const { return m_Data; }
+		size_t GetSize() const { return m_Size; }
+		std::string_view GetText() const { return { (const char*)m_Data, m_Size }; }
+		// False if the bytes were decompressed into a private buffer
+		bool IsMapped() const { return m_Mapping != nullptr; }
+
+		void Reset() { *this = FileData(); }
+	private:
+		friend class FileSystem;
+		friend class PackedArchive;
+
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+		std::shared_ptr<const MappedFile> m_Mapping;
+		std::vector<uint8_t> m_Buffer;
+	};
+
+	// Virtual file system. Paths are '/'-separated and resolved against the
+	// mount points, most recent mount first; a mount is either a directory
+	// or a packed archive (.glpak, see PackedArchive.h). Paths no mount
+	// provides fall back to the working directory, so nothing needs to be
+	// mounted for loose assets next to the executable. Thread-safe.
+	class FileSystem
+	{
+	public:
+		// Mounts the directory or archive at physicalPath under mountPoint
+		// ("" for the root). Logs and returns false if it cannot be opened.
+		static bool Mount(const std::string& mountPoint, const std::string& physicalPath);
+		static void Unmount(const std::string& mountPoint);
+		static void UnmountAll();
+
+		static bool Exists(const std::string& path);
+		// Logs and returns false if no mount has the file
+		static bool Read(const std::string& path, FileData& outData);
+		static bool ReadText(const std::string& path, std::string& outText);
+
+		// Loose file backing path, if any; tools such as the mesh cooker
+		// need a real file to compare timestamps and write next to
+		static bool GetPhysicalPath(const std::string& path, std::string& outPhysicalPath);
+		// Writes the loose file at physicalPath, bypassing the mounts, through
+		// a temporary file and a rename, so a reader never maps it half-written.
+		// Logs and returns false on failure.
+		static bool WriteFileAtomic(const std::string& physicalPath, const void* data, size_t size);
+
+		// "./a//b/../c" -> "a/c"
+		static std::string NormalizePath(const std::string& path);
+	};
+
+}
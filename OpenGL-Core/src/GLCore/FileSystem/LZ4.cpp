@@ -0,0 +1,163 @@
+#include "glpch.h"
+#include "LZ4.h"
+
+#include <cstring>
+
+namespace GLCore::LZ4 {
+
+	static constexpr size_t MinMatch = 4;
+	// The last match must start this far from the end and the last five
+	// bytes are always literals; decoders rely on both
+	static constexpr size_t MatchStartLimit = 12;
+	static constexpr size_t LastLiterals = 5;
+	static constexpr size_t MaxOffset = 65535;
+	static constexpr uint32_t HashBits = 14;
+
+	static uint32_t Read32(const uint8_t* p)
+	{
+		uint32_t value;
+		memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	static uint32_t Hash(uint32_t sequence)
+	{
+		return (sequence * 2654435761u) >> (32 - HashBits);
+	}
+
+	static void WriteLength(std::vector<uint8_t>& out, size_t length)
+	{
+		for (; length >= 255; length -= 255)
+			out.push_back(255);
+		out.push_back((uint8_t)length);
+	}
+
+	static void WriteSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalCount, size_t offset, size_t matchLength)
+	{
+		size_t matchCode = matchLength - MinMatch;
+		uint8_t token = (uint8_t)((std::min<size_t>(literalCount, 15) << 4) | std::min<size_t>(matchCode, 15));
+		out.push_back(token);
+		if (literalCount >= 15)
+			WriteLength(out, literalCount - 15);
+		out.insert(out.end(), literals, literals + literalCount);
+
+		out.push_back((uint8_t)(offset & 0xFF));
+		out.push_back((uint8_t)(offset >> 8));
+		if (matchCode >= 15)
+			WriteLength(out, matchCode - 15);
+	}
+
+	void Compress(const uint8_t* data, size_t size, std::vector<uint8_t>& outCompressed)
+	{
+		outCompressed.clear();
+		outCompressed.reserve(size + size / 255 + 16);
+
+		size_t position = 0, anchor = 0;
+		if (size > MatchStartLimit)
+		{
+			std::vector<int64_t> table((size_t)1 << HashBits, -1);
+			size_t searchEnd = size - MatchStartLimit;
+			size_t matchEnd = size - LastLiterals;
+
+			while (position <= searchEnd)
+			{
+				uint32_t sequence = Read32(data + position);
+				uint32_t hash = Hash(sequence);
+				int64_t candidate = table[hash];
+				table[hash] = (int64_t)position;
+
+				if (candidate < 0 || position - (size_t)candidate > MaxOffset || Read32(data + candidate) != sequence)
+				{
+					position++;
+					continue;
+				}
+
+				size_t length = MinMatch;
+				while (position + length < matchEnd && data[candidate + length] == data[position + length])
+					length++;
+
+				WriteSequence(outCompressed, data + anchor, position - anchor, position - (size_t)candidate, length);
+				position += length;
+				anchor = position;
+			}
+		}
+
+		size_t literalCount = size - anchor;
+		outCompressed.push_back((uint8_t)(std::min<size_t>(literalCount, 15) << 4));
+		if (literalCount >= 15)
+			WriteLength(outCompressed, literalCount - 15);
+		outCompressed.insert(outCompressed.end(), data + anchor, data + size);
+	}
+
+	bool Decompress(const uint8_t* compressed, size_t compressedSize, uint8_t* destination, size_t size)
+	{
+		const uint8_t* in = compressed;
+		const uint8_t* inEnd = compressed + compressedSize;
+		uint8_t* out = destination;
+		uint8_t* outEnd = destination + size;
+
+		// Extension bytes of a 4-bit length field
+		auto readLength = [&](size_t& length)
+		{
+			uint8_t byte;
+			do
+			{
+				if (in == inEnd)
+					return false;
+				byte = *in++;
+				length += byte;
+			} while (byte == 255);
+			return true;
+		};
+
+		while (in < inEnd)
+		{
+			uint8_t token = *in++;
+
+			size_t literalCount = token >> 4;
+			if (literalCount == 15 && !readLength(literalCount))
+				return false;
+			if (literalCount > (size_t)(inEnd - in) || literalCount > (size_t)(outEnd - out))
+				return false;
+			if (literalCount)
+				memcpy(out, in, literalCount);
+			in += literalCount;
+			out += literalCount;
+
+			// The last sequence has no match
+			if (in == inEnd)
+				return out == outEnd;
+
+			if (inEnd - in < 2)
+				return false;
+			size_t offset = (size_t)in[0] | ((size_t)in[1] << 8);
+			in += 2;
+			if (offset == 0 || offset > (size_t)(out - destination))
+				return false;
+
+			size_t length = token & 15;
+			if (length == 15 && !readLength(length))
+				return false;
+			length += MinMatch;
+			if (length > (size_t)(outEnd - out))
+				return false;
+
+			// Overlapping matches repeat the last offset bytes, so they have
+			// to be copied front to back
+			const uint8_t* match = out - offset;
+			if (offset >= length)
+			{
+				memcpy(out, match, length);
+				out += length;
+			}
+			else
+			{
+				for (size_t i = 0; i < length; i++)
+					*out++ = *match++;
+			}
+		}
+
+		return false;
+	}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Raw LZ4 block format (no frame header or checksums), compatible with
+// LZ4_compress_default / LZ4_decompress_safe. The encoder is a plain
+// greedy one: packing is offline, so only decoding speed matters.
+namespace GLCore::LZ4 {
+
+	// Replaces outCompressed with the compressed block
+	void Compress(const uint8_t* data, size_t size, std::vector<uint8_t>& outCompressed);
+
+	// Upper bound of decompressed / compressed size: a length extension byte
+	// adds at most 255 bytes of output
+	constexpr uint64_t MaxExpansion = 255;
+
+	// Decodes a block whose decompressed size is known up front. Every read
+	// and write is bounds-checked, so corrupt input only returns false.
+	bool Decompress(const uint8_t* compressed, size_t compressedSize, uint8_t* destination, size_t size);
+
+}
@@ -0,0 +1,217 @@
+#include "glpch.h"
+#include "PackedArchive.h"
+
+#include "FileSystem.h"
+#include "LZ4.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace GLCore {
+
+	static uint64_t AlignUp(uint64_t value, uint64_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	uint64_t HashArchivePath(std::string_view path)
+	{
+		uint64_t hash = 0xCBF29CE484222325ull;
+		for (char c : path)
+		{
+			hash ^= (uint8_t)c;
+			hash *= 0x100000001B3ull;
+		}
+		return hash;
+	}
+
+	bool PackedArchive::Open(const std::string& filepath)
+	{
+		auto file = std::make_shared<MappedFile>();
+		if (!file->Open(filepath))
+			return false;
+
+		const uint8_t* data = file->GetData();
+		size_t size = file->GetSize();
+		const PackedArchiveHeader* header = (const PackedArchiveHeader*)data;
+
+		// Every field is untrusted 64-bit data, so ranges are checked as
+		// offset <= size && length <= size - offset, which cannot wrap
+		bool valid = size >= sizeof(PackedArchiveHeader)
+			&& header->Magic == PackedArchiveHeader::MagicValue
+			&& header->Version == PackedArchiveHeader::CurrentVersion
+			&& header->IndexOffset % alignof(PackedArchiveEntry) == 0
+			&& header->IndexOffset <= size
+			&& (uint64_t)header->EntryCount * sizeof(PackedArchiveEntry) <= size - header->IndexOffset
+			&& header->StringTableOffset <= size
+			&& header->StringTableSize <= size - header->StringTableOffset;
+
+		const PackedArchiveEntry* entries = valid ? (const PackedArchiveEntry*)(data + header->IndexOffset) : nullptr;
+		for (uint32_t i = 0; valid && i < header->EntryCount; i++)
+		{
+			const PackedArchiveEntry& entry = entries[i];
+			// A compressed entry's Size sizes the Read() buffer, so it must be
+			// one the stored bytes can actually decode to
+			bool sizeValid = (entry.Flags & PackedArchiveEntry::CompressedLZ4)
+				? entry.Size / LZ4::MaxExpansion <= entry.StoredSize
+				: entry.Size == entry.StoredSize;
+
+			valid = entry.DataOffset <= size && entry.StoredSize <= size - entry.DataOffset
+				&& (uint64_t)entry.PathOffset + entry.PathLength <= header->StringTableSize
+				&& (i == 0 || entries[i - 1].PathHash <= entry.PathHash)
+				&& sizeValid;
+		}
+
+		if (!valid)
+		{
+			LOG_ERROR("'{0}' is not a valid version {1} packed archive", filepath, PackedArchiveHeader::CurrentVersion);
+			return false;
+		}
+
+		m_Path = filepath;
+		m_Entries = entries;
+		m_EntryCount = header->EntryCount;
+		m_Strings = (const char*)data + header->StringTableOffset;
+		m_File = std::move(file);
+		return true;
+	}
+
+	const PackedArchiveEntry* PackedArchive::Find(std::string_view path) const
+	{
+		uint64_t hash = HashArchivePath(path);
+		const PackedArchiveEntry* end = m_Entries + m_EntryCount;
+		const PackedArchiveEntry* it = std::lower_bound(m_Entries, end, hash,
+			[](const PackedArchiveEntry& entry, uint64_t value) { return entry.PathHash < value; });
+
+		for (; it != end && it->PathHash == hash; ++it)
+		{
+			if (GetEntryPath(*it) == path)
+				return it;
+		}
+		return nullptr;
+	}
+
+	std::string_view PackedArchive::GetEntryPath(const PackedArchiveEntry& entry) const
+	{
+		return { m_Strings + entry.PathOffset, entry.PathLength };
+	}
+
+	bool PackedArchive::Read(const PackedArchiveEntry& entry, FileData& outData) const
+	{
+		const uint8_t* stored = m_File->GetData() + entry.DataOffset;
+
+		outData.Reset();
+		if (!(entry.Flags & PackedArchiveEntry::CompressedLZ4))
+		{
+			outData.m_Data = stored;
+			outData.m_Size = (size_t)entry.Size;
+			outData.m_Mapping = m_File;
+			return true;
+		}
+
+		outData.m_Buffer.resize((size_t)entry.Size);
+		if (!LZ4::Decompress(stored, (size_t)entry.StoredSize, outData.m_Buffer.data(), outData.m_Buffer.size()))
+		{
+			LOG_ERROR("Corrupt entry '{0}' in archive '{1}'", GetEntryPath(entry), m_Path);
+			outData.Reset();
+			return false;
+		}
+
+		outData.m_Data = outData.m_Buffer.data();
+		outData.m_Size = outData.m_Buffer.size();
+		return true;
+	}
+
+	bool PackDirectory(const std::string& directory, const std::string& archivePath, const PackOptions& options)
+	{
+		namespace fs = std::filesystem;
+
+		std::error_code error;
+		std::vector<fs::path> files;
+		for (fs::recursive_directory_iterator it(directory, error), end; !error && it != end; it.increment(error))
+		{
+			if (it->is_regular_file(error))
+				files.push_back(it->path());
+		}
+		if (error)
+		{
+			LOG_ERROR("Could not pack '{0}': {1}", directory, error.message());
+			return false;
+		}
+
+		std::vector<PackedArchiveEntry> entries;
+		std::string strings;
+		std::vector<uint8_t> archive(AlignUp(sizeof(PackedArchiveHeader), 16), 0);
+		std::vector<uint8_t> contents, compressed;
+		uint64_t totalSize = 0;
+
+		for (const fs::path& file : files)
+		{
+			// Packing into the directory itself must not pick up an older archive
+			std::error_code ignored;
+			if (fs::equivalent(file, archivePath, ignored))
+				continue;
+
+			std::string path = fs::relative(file, directory, error).generic_string();
+			std::ifstream in(file, std::ios::in | std::ios::binary);
+			if (error || !in)
+			{
+				LOG_ERROR("Could not read '{0}'", file.string());
+				return false;
+			}
+			contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+			PackedArchiveEntry entry;
+			entry.PathHash = HashArchivePath(path);
+			entry.PathOffset = (uint32_t)strings.size();
+			entry.PathLength = (uint32_t)path.size();
+			entry.Size = contents.size();
+			strings += path;
+
+			std::string extension = file.extension().string();
+			std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)tolower(c); });
+			bool store = !options.Compress || contents.empty()
+				|| std::find(options.StoreExtensions.begin(), options.StoreExtensions.end(), extension) != options.StoreExtensions.end();
+
+			const std::vector<uint8_t>* data = &contents;
+			if (!store)
+			{
+				LZ4::Compress(contents.data(), contents.size(), compressed);
+				if ((float)compressed.size() < (float)contents.size() * options.MinCompressionRatio)
+				{
+					entry.Flags |= PackedArchiveEntry::CompressedLZ4;
+					data = &compressed;
+				}
+			}
+
+			entry.DataOffset = archive.size();
+			entry.StoredSize = data->size();
+			archive.insert(archive.end(), data->begin(), data->end());
+			archive.resize(AlignUp(archive.size(), 16), 0);
+
+			entries.push_back(entry);
+			totalSize += entry.Size;
+		}
+
+		std::sort(entries.begin(), entries.end(), [](const PackedArchiveEntry& a, const PackedArchiveEntry& b) { return a.PathHash < b.PathHash; });
+
+		PackedArchiveHeader header;
+		header.EntryCount = (uint32_t)entries.size();
+		header.IndexOffset = archive.size();
+		archive.insert(archive.end(), (const uint8_t*)entries.data(), (const uint8_t*)(entries.data() + entries.size()));
+		header.StringTableOffset = archive.size();
+		header.StringTableSize = strings.size();
+		archive.insert(archive.end(), strings.begin(), strings.end());
+		memcpy(archive.data(), &header, sizeof(header));
+
+		// A running build may have the previous archive mounted
+		if (!FileSystem::WriteFileAtomic(archivePath, archive.data(), archive.size()))
+			return false;
+
+		LOG_INFO("Packed {0} files from '{1}' into '{2}' ({3} -> {4} bytes)", entries.size(), directory, archivePath, totalSize, archive.size());
+		return true;
+	}
+
+}
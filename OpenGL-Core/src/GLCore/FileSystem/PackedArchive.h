@@ -0,0 +1,90 @@
+#pragma once
+
+#include "GLCore/Core/MappedFile.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GLCore {
+
+	class FileData;
+
+	// Packed archive (.glpak): this header, the entry data, then the index
+	// (EntryCount entries sorted by PathHash) and a string table holding the
+	// paths. Entry data is 16-byte aligned, so uncompressed entries such as
+	// cooked meshes can be used straight from the mapping.
+	struct PackedArchiveHeader
+	{
+		static constexpr uint32_t MagicValue = 0x4B415047; // "GPAK"
+		static constexpr uint32_t CurrentVersion = 1;
+
+		uint32_t Magic = MagicValue;
+		uint32_t Version = CurrentVersion;
+		uint32_t EntryCount = 0;
+		uint32_t Reserved = 0;
+		uint64_t IndexOffset = 0;
+		uint64_t StringTableOffset = 0;
+		uint64_t StringTableSize = 0;
+	};
+
+	struct PackedArchiveEntry
+	{
+		static constexpr uint32_t CompressedLZ4 = 1 << 0;
+
+		uint64_t PathHash = 0;
+		uint64_t DataOffset = 0;
+		uint64_t StoredSize = 0; // Bytes in the archive
+		uint64_t Size = 0;       // Bytes once decompressed
+		uint32_t PathOffset = 0; // Into the string table, not null-terminated
+		uint32_t PathLength = 0;
+		uint32_t Flags = 0;
+		uint32_t Reserved = 0;
+	};
+
+	// FNV-1a of an archive-relative path such as "shaders/test.vert.glsl"
+	uint64_t HashArchivePath(std::string_view path);
+
+	// Read-only view of a mapped archive. Opening costs one open() and one
+	// mapping however many files it holds; lookups are a binary search over
+	// the index. Safe to read from any number of threads.
+	class PackedArchive
+	{
+	public:
+		// Logs and returns false if the file is missing or malformed
+		bool Open(const std::string& filepath);
+
+		const std::string& GetPath() const { return m_Path; }
+		uint32_t GetEntryCount() const { return (uint32_t)m_EntryCount; }
+
+		// path is relative to the archive root, '/'-separated
+		const PackedArchiveEntry* Find(std::string_view path) const;
+		std::string_view GetEntryPath(const PackedArchiveEntry& entry) const;
+
+		// Uncompressed entries alias the mapping, compressed ones are
+		// decompressed into a buffer owned by outData
+		bool Read(const PackedArchiveEntry& entry, FileData& outData) const;
+	private:
+		std::string m_Path;
+		// Shared with every FileData pointing into it, so reads stay valid
+		// after the archive is unmounted
+		std::shared_ptr<MappedFile> m_File;
+		const PackedArchiveEntry* m_Entries = nullptr;
+		size_t m_EntryCount = 0;
+		const char* m_Strings = nullptr;
+	};
+
+	struct PackOptions
+	{
+		bool Compress = true;
+		// Entries that do not shrink below this fraction are stored as is
+		float MinCompressionRatio = 0.9f;
+		// Already compressed, or meant to be used straight from the mapping
+		std::vector<std::string> StoreExtensions = { ".glmesh", ".png", ".jpg", ".jpeg" };
+	};
+
+	// Packs every regular file under directory (recursively) into archivePath
+	bool PackDirectory(const std::string& directory, const std::string& archivePath, const PackOptions& options = {});
+
+}
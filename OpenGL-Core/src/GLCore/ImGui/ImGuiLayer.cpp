@@ -12,6 +12,102 @@
 
 namespace GLCore {
 
+	// Deep copy of a frame's draw data, so the render thread can replay it
+	// while the main thread already builds the next ImGui frame
+	struct ImGuiDrawDataSnapshot
+	{
+		ImDrawData DrawData;
+		std::vector<ImDrawList*> DrawLists;
+
+		ImGuiDrawDataSnapshot(const ImDrawData* source)
+			: DrawData(*source)
+		{
+			for (int i = 0; i < source->CmdListsCount; i++)
+				DrawLists.push_back(source->CmdLists[i]->CloneOutput());
+			DrawData.CmdLists = DrawLists.data();
+		}
+
+		~ImGuiDrawDataSnapshot()
+		{
+			for (ImDrawList* drawList : DrawLists)
+				IM_DELETE(drawList);
+		}
+	};
+
+	// Wraps the GLFW backend's Platform_CreateWindow so that input to platform
+	// windows also wakes a reactive main loop. The backend installs the same
+	// callbacks on every platform window, so one saved pointer per kind suffices.
+	static void (*s_BackendCreateWindow)(ImGuiViewport*) = nullptr;
+	static GLFWmousebuttonfun s_BackendMouseButtonCallback = nullptr;
+	static GLFWscrollfun s_BackendScrollCallback = nullptr;
+	static GLFWkeyfun s_BackendKeyCallback = nullptr;
+	static GLFWcharfun s_BackendCharCallback = nullptr;
+	static GLFWcursorposfun s_BackendCursorPosCallback = nullptr;
+	static GLFWwindowposfun s_BackendWindowPosCallback = nullptr;
+	static GLFWwindowsizefun s_BackendWindowSizeCallback = nullptr;
+	static GLFWwindowclosefun s_BackendWindowCloseCallback = nullptr;
+
+	static void NotifyPlatformWindowInput()
+	{
+		Application::Get().GetImGuiLayer().OnPlatformWindowInput();
+	}
+
+	static void CreatePlatformWindow(ImGuiViewport* viewport)
+	{
+		s_BackendCreateWindow(viewport);
+
+		GLFWwindow* window = static_cast<GLFWwindow*>(viewport->PlatformHandle);
+		s_BackendMouseButtonCallback = glfwSetMouseButtonCallback(window, [](GLFWwindow* window, int button, int action, int mods)
+		{
+			if (s_BackendMouseButtonCallback)
+				s_BackendMouseButtonCallback(window, button, action, mods);
+			NotifyPlatformWindowInput();
+		});
+		s_BackendScrollCallback = glfwSetScrollCallback(window, [](GLFWwindow* window, double xOffset, double yOffset)
+		{
+			if (s_BackendScrollCallback)
+				s_BackendScrollCallback(window, xOffset, yOffset);
+			NotifyPlatformWindowInput();
+		});
+		s_BackendKeyCallback = glfwSetKeyCallback(window, [](GLFWwindow* window, int key, int scancode, int action, int mods)
+		{
+			if (s_BackendKeyCallback)
+				s_BackendKeyCallback(window, key, scancode, action, mods);
+			NotifyPlatformWindowInput();
+		});
+		s_BackendCharCallback = glfwSetCharCallback(window, [](GLFWwindow* window, unsigned int codepoint)
+		{
+			if (s_BackendCharCallback)
+				s_BackendCharCallback(window, codepoint);
+			NotifyPlatformWindowInput();
+		});
+		// The backend polls the cursor, but hovering still changes the UI
+		s_BackendCursorPosCallback = glfwSetCursorPosCallback(window, [](GLFWwindow* window, double x, double y)
+		{
+			if (s_BackendCursorPosCallback)
+				s_BackendCursorPosCallback(window, x, y);
+			NotifyPlatformWindowInput();
+		});
+		s_BackendWindowPosCallback = glfwSetWindowPosCallback(window, [](GLFWwindow* window, int x, int y)
+		{
+			if (s_BackendWindowPosCallback)
+				s_BackendWindowPosCallback(window, x, y);
+			NotifyPlatformWindowInput();
+		});
+		s_BackendWindowSizeCallback = glfwSetWindowSizeCallback(window, [](GLFWwindow* window, int width, int height)
+		{
+			if (s_BackendWindowSizeCallback)
+				s_BackendWindowSizeCallback(window, width, height);
+			NotifyPlatformWindowInput();
+		});
+		s_BackendWindowCloseCallback = glfwSetWindowCloseCallback(window, [](GLFWwindow* window)
+		{
+			if (s_BackendWindowCloseCallback)
+				s_BackendWindowCloseCallback(window);
+			NotifyPlatformWindowInput();
+		});
+	}
+
 	ImGuiLayer::ImGuiLayer()
 		: Layer("ImGuiLayer")
 	{
@@ -45,6 +141,10 @@ namespace GLCore {
 		// Setup Platform/Renderer bindings
 		ImGui_ImplGlfw_InitForOpenGL(window, true);
 		ImGui_ImplOpenGL3_Init("#version 410");
+
+		ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+		s_BackendCreateWindow = platformIO.Platform_CreateWindow;
+		platformIO.Platform_CreateWindow = CreatePlatformWindow;
 	}
 
 	void ImGuiLayer::OnDetach()
@@ -54,38 +154,144 @@ namespace GLCore {
 		ImGui::DestroyContext();
 	}
 	
-	void ImGuiLayer::Begin()
+	// Hover delays, tooltips and fades keep changing for a moment after input
+	static constexpr double s_IdleGracePeriod = 1.0;
+
+	bool ImGuiLayer::IsActive() const
+	{
+		if (m_RedrawRequested)
+			return true;
+
+		// Text fields blink their cursor, active widgets may animate
+		if (ImGui::GetIO().WantTextInput || ImGui::IsAnyItemActive())
+			return true;
+
+		return glfwGetTime() - m_LastActivityTime < s_IdleGracePeriod;
+	}
+
+	void ImGuiLayer::CreateDeviceObjects()
 	{
-		ImGui_ImplOpenGL3_NewFrame();
+		// Builds io.Fonts too, so NewFrame() on the main thread finds it ready
+		ImGui_ImplOpenGL3_CreateDeviceObjects();
+	}
+
+	bool ImGuiLayer::Begin()
+	{
+		m_Building = !m_IdleMode || IsActive();
+		m_Stats.Rebuilt = m_Building;
+		if (!m_Building)
+		{
+			m_Stats.IdleFrames++;
+			m_Stats.BuildTime = 0.0f;
+			return false;
+		}
+
+		m_RedrawRequested = false;
+		m_Stats.IdleFrames = 0;
+		m_BuildStartTime = glfwGetTime();
+
+		ImGuiIO& io = ImGui::GetIO();
+		if (Application::Get().IsPipelinedRendering())
+		{
+			// Platform windows need the GL context on this thread
+			io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+		}
+		else
+		{
+			if (m_ViewportsEnabled)
+				io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+			else
+				io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+
+			ImGui_ImplOpenGL3_NewFrame();
+		}
 		ImGui_ImplGlfw_NewFrame();
 		ImGui::NewFrame();
+		return true;
 	}
 
 	void ImGuiLayer::End()
 	{
 		ImGuiIO& io = ImGui::GetIO();
 		Application& app = Application::Get();
-		io.DisplaySize = ImVec2((float)app.GetWindow().GetWidth(), (float)app.GetWindow().GetHeight());
 
-		// Rendering
-		ImGui::Render();
+		if (m_Building)
+		{
+			io.DisplaySize = ImVec2((float)app.GetWindow().GetWidth(), (float)app.GetWindow().GetHeight());
+
+			// Rendering
+			ImGui::Render();
+
+			ImDrawData* drawData = ImGui::GetDrawData();
+			m_Stats.VertexCount = (uint32_t)drawData->TotalVtxCount;
+			m_Stats.IndexCount = (uint32_t)drawData->TotalIdxCount;
+			m_Stats.BuildTime = (float)((glfwGetTime() - m_BuildStartTime) * 1000.0);
+
+			if (app.IsPipelinedRendering())
+				m_LastSnapshot = std::make_shared<ImGuiDrawDataSnapshot>(drawData);
+		}
+
+		if (app.IsPipelinedRendering())
+		{
+			// Idle frames resubmit the snapshot instead of cloning the lists again
+			std::shared_ptr<ImGuiDrawDataSnapshot> snapshot = m_LastSnapshot;
+			app.SubmitRenderCommand([this, snapshot]()
+			{
+				// Only the snapshot and the backend's GL objects, never ImGui
+				// state the main thread is building the next frame in
+				double startTime = glfwGetTime();
+				ImGui_ImplOpenGL3_RenderDrawData(&snapshot->DrawData);
+				m_RenderTime = (float)((glfwGetTime() - startTime) * 1000.0);
+			});
+			return;
+		}
+
+		// The draw data of the last Render() stays valid until the next NewFrame()
+		double startTime = glfwGetTime();
 		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
-		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+		// Idle platform windows keep showing their last presented image
+		if (m_Building && (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable))
 		{
 			GLFWwindow* backup_current_context = glfwGetCurrentContext();
 			ImGui::UpdatePlatformWindows();
 			ImGui::RenderPlatformWindowsDefault();
 			glfwMakeContextCurrent(backup_current_context);
 		}
+		m_RenderTime = (float)((glfwGetTime() - startTime) * 1000.0);
+	}
+
+	void ImGuiLayer::SetViewportsEnabled(bool enabled)
+	{
+		if (enabled == m_ViewportsEnabled)
+			return;
+
+		m_ViewportsEnabled = enabled;
+		RequestRedraw();
+	}
+
+	ImGuiFrameStats ImGuiLayer::GetFrameStats() const
+	{
+		ImGuiFrameStats stats = m_Stats;
+		stats.RenderTime = m_RenderTime.load();
+		return stats;
 	}
 
 	void ImGuiLayer::OnEvent(Event& event)
 	{
+		if (event.IsInCategory(EventCategoryInput) || event.GetEventType() == EventType::WindowResize)
+			m_LastActivityTime = glfwGetTime();
+
 		EventDispatcher dispatcher(event);
 		dispatcher.Dispatch<MouseButtonPressedEvent>(GLCORE_BIND_EVENT_FN(ImGuiLayer::OnMouseButtonPressed));
 	}
 
+	void ImGuiLayer::OnPlatformWindowInput()
+	{
+		m_LastActivityTime = glfwGetTime();
+		Application::Get().RequestRedraw();
+	}
+
 	bool ImGuiLayer::OnMouseButtonPressed(MouseButtonPressedEvent& e)
 	{
 		ImGuiIO io = ImGui::GetIO();
@@ -6,8 +6,27 @@
 #include "GLCore/Events/KeyEvent.h"
 #include "GLCore/Events/MouseEvent.h"
 
+#include <atomic>
+#include <memory>
+
 namespace GLCore {
 
+	struct ImGuiDrawDataSnapshot;
+
+	struct ImGuiFrameStats
+	{
+		// False when idle mode reused the previous frame's draw data
+		bool Rebuilt = true;
+		uint32_t IdleFrames = 0; // Consecutive reused frames
+
+		// CPU milliseconds: NewFrame, layers' OnImGuiRender and Render...
+		float BuildTime = 0.0f;
+		// ...and RenderDrawData plus platform windows
+		float RenderTime = 0.0f;
+
+		uint32_t VertexCount = 0, IndexCount = 0;
+	};
+
 	class ImGuiLayer : public Layer
 	{
 	public:
@@ -17,13 +36,49 @@ namespace GLCore {
 		virtual void OnAttach() override;
 		virtual void OnDetach() override;
 
-		void Begin();
+		// Returns false when the previous frame is reused; OnImGuiRender must
+		// not be called until the matching End() then
+		bool Begin();
 		void End();
 
-		virtual void ImGuiLayer::OnEvent(Event& event);
-		bool ImGuiLayer::OnMouseButtonPressed(MouseButtonPressedEvent& e);
+		// Builds the font atlas and the renderer backend's GL objects; must
+		// run on the context thread before the context moves to the render
+		// thread, which then only replays draw data
+		void CreateDeviceObjects();
+
+		virtual void OnEvent(Event& event);
+		bool OnMouseButtonPressed(MouseButtonPressedEvent& e);
+		// Input to platform windows goes straight to ImGui's GLFW callbacks
+		// and never reaches OnEvent, so they report it here
+		void OnPlatformWindowInput();
+
+		// In idle mode the UI is only rebuilt for input, window changes and
+		// redraw requests (and briefly afterwards, for hover delays and
+		// animations); other frames redraw the last draw data
+		void SetIdleMode(bool enabled) { m_IdleMode = enabled; }
+		bool IsIdleMode() const { return m_IdleMode; }
+		// For UI that changes without input, e.g. a statistics panel
+		void RequestRedraw() { m_RedrawRequested = true; }
+		// True while the UI may still change without further input, which
+		// needs more frames even when the application is otherwise idle
+		bool IsActive() const;
+
+		// Platform windows cost a context switch per window per frame
+		void SetViewportsEnabled(bool enabled);
+		bool IsViewportsEnabled() const { return m_ViewportsEnabled; }
+
+		ImGuiFrameStats GetFrameStats() const;
 	private:
-		float m_Time = 0.0f;
+		bool m_IdleMode = false;
+		bool m_ViewportsEnabled = true;
+		bool m_RedrawRequested = true;
+		bool m_Building = false;
+		double m_LastActivityTime = 0.0, m_BuildStartTime = 0.0;
+
+		std::shared_ptr<ImGuiDrawDataSnapshot> m_LastSnapshot;
+
+		ImGuiFrameStats m_Stats;
+		std::atomic<float> m_RenderTime = 0.0f; // Written by the render thread when pipelined
 	};
 
-}
\ No newline at end of file
+}
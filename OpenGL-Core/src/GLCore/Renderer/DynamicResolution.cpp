@@ -0,0 +1,47 @@
+#include "glpch.h"
+#include "DynamicResolution.h"
+
+#include <glm/glm.hpp>
+
+namespace GLCore {
+
+	DynamicResolution::DynamicResolution(const DynamicResolutionSpecification& specification)
+		: m_Specification(specification)
+	{
+		Reset();
+	}
+
+	void DynamicResolution::Reset()
+	{
+		m_Scale = m_Setpoint = m_Specification.MaxScale;
+		m_PreviousError = 0.0f;
+	}
+
+	float DynamicResolution::Update(float gpuTime)
+	{
+		const DynamicResolutionSpecification& spec = m_Specification;
+		if (gpuTime <= 0.0f || spec.TargetFrameTime <= 0.0f)
+			return m_Scale;
+
+		// Positive when there is headroom, negative when over budget
+		float error = std::sqrt(spec.TargetFrameTime / gpuTime) - 1.0f;
+		if (std::abs(error) < spec.Hysteresis)
+		{
+			// Hold; the band counts as zero error for the derivative
+			m_PreviousError = 0.0f;
+			return m_Scale;
+		}
+
+		float derivative = error - m_PreviousError;
+		m_PreviousError = error;
+
+		float adjustment = spec.Proportional * error + spec.Derivative * derivative;
+		m_Setpoint = glm::clamp(m_Setpoint * (1.0f + adjustment), spec.MinScale, spec.MaxScale);
+
+		if (std::abs(m_Setpoint - m_Scale) >= spec.MinScaleStep || m_Setpoint == spec.MinScale || m_Setpoint == spec.MaxScale)
+			m_Scale = m_Setpoint;
+
+		return m_Scale;
+	}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+namespace GLCore {
+
+	struct DynamicResolutionSpecification
+	{
+		// GPU time budget for the scaled scene, in milliseconds
+		float TargetFrameTime = 12.0f;
+
+		float MinScale = 0.5f, MaxScale = 1.0f;
+
+		// Errors within this fraction of the target are ignored, and scale
+		// changes smaller than MinScaleStep are not applied
+		float Hysteresis = 0.05f;
+		float MinScaleStep = 0.02f;
+
+		// Gains applied to the relative time error. The scale is changed by a
+		// fraction of its value every frame, which already integrates the
+		// error, so there is no separate integral term.
+		float Proportional = 0.10f, Derivative = 0.05f;
+
+		uint32_t Samples = 1;
+	};
+
+	// Incremental PD controller that turns measured GPU time into a render
+	// resolution scale. Pixel cost grows with the square of the scale, so the
+	// error is taken against the square root of the time ratio. Within the
+	// hysteresis band the scale holds still.
+	class DynamicResolution
+	{
+	public:
+		DynamicResolution(const DynamicResolutionSpecification& specification = DynamicResolutionSpecification());
+
+		// Feed one GPU time sample; returns the scale to render the next frame at
+		float Update(float gpuTime);
+		void Reset();
+
+		float GetScale() const { return m_Scale; }
+		const DynamicResolutionSpecification& GetSpecification() const { return m_Specification; }
+	private:
+		DynamicResolutionSpecification m_Specification;
+		float m_Scale = 1.0f;     // Currently applied
+		float m_Setpoint = 1.0f;  // Unquantized controller output
+		float m_PreviousError = 0.0f;
+	};
+
+}
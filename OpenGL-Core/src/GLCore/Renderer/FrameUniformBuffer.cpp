@@ -0,0 +1,66 @@
+#include "glpch.h"
+#include "FrameUniformBuffer.h"
+
+#include <cstring>
+
+namespace GLCore {
+
+	FrameUniformBuffer::~FrameUniformBuffer()
+	{
+		for (GLsync fence : m_Fences)
+		{
+			if (fence)
+				glDeleteSync(fence);
+		}
+
+		if (m_RendererID)
+		{
+			glUnmapNamedBuffer(m_RendererID);
+			glDeleteBuffers(1, &m_RendererID);
+		}
+	}
+
+	void FrameUniformBuffer::Create()
+	{
+		GLint alignment = 256;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		m_Stride = (uint32_t)((sizeof(FrameData) + alignment - 1) / alignment * alignment);
+
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glCreateBuffers(1, &m_RendererID);
+		glNamedBufferStorage(m_RendererID, m_Stride * RegionCount, nullptr, flags);
+		m_Mapped = (uint8_t*)glMapNamedBufferRange(m_RendererID, 0, m_Stride * RegionCount, flags);
+		GLCORE_ASSERT(m_Mapped, "Could not map the frame uniform buffer!");
+	}
+
+	void FrameUniformBuffer::Update(const FrameData& data)
+	{
+		if (!m_RendererID)
+			Create();
+
+		// Everything submitted since the last Update read the current region
+		if (m_FrameIndex > 0)
+		{
+			m_Fences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			m_Region = (m_Region + 1) % RegionCount;
+		}
+
+		// Only blocks when the CPU is RegionCount frames ahead of the GPU
+		if (GLsync fence = m_Fences[m_Region])
+		{
+			GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+			if (result == GL_TIMEOUT_EXPIRED || result == GL_WAIT_FAILED)
+				LOG_WARN("Timed out waiting for the GPU to release frame uniform data");
+
+			glDeleteSync(fence);
+			m_Fences[m_Region] = nullptr;
+		}
+
+		FrameData* destination = (FrameData*)(m_Mapped + m_Region * m_Stride);
+		memcpy(destination, &data, sizeof(FrameData));
+		destination->FrameIndex = m_FrameIndex++;
+
+		glBindBufferRange(GL_UNIFORM_BUFFER, BindingPoint, m_RendererID, m_Region * m_Stride, sizeof(FrameData));
+	}
+
+}
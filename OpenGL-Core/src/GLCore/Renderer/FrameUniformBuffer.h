@@ -0,0 +1,75 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <array>
+
+namespace GLCore {
+
+	// Per-frame data shared by every shader, laid out to match this std140
+	// block. Utils::Shader binds any program that declares it to
+	// FrameUniformBuffer::BindingPoint, so no per-program uniform upload is
+	// needed:
+	//
+	//   layout (std140) uniform FrameData
+	//   {
+	//       mat4 u_ViewProjection;
+	//       mat4 u_View;
+	//       mat4 u_Projection;
+	//       mat4 u_InverseViewProjection;
+	//       vec4 u_Viewport;   // width, height, 1 / width, 1 / height
+	//       float u_Time;
+	//       float u_DeltaTime;
+	//       uint u_FrameIndex;
+	//   };
+	struct FrameData
+	{
+		glm::mat4 ViewProjection = glm::mat4(1.0f);
+		glm::mat4 View = glm::mat4(1.0f);
+		glm::mat4 Projection = glm::mat4(1.0f);
+		glm::mat4 InverseViewProjection = glm::mat4(1.0f);
+		glm::vec4 Viewport = { 0.0f, 0.0f, 0.0f, 0.0f };
+		float Time = 0.0f;
+		float DeltaTime = 0.0f;
+		uint32_t FrameIndex = 0;
+		float Padding = 0.0f;
+	};
+
+	static_assert(sizeof(FrameData) == 4 * 64 + 16 + 16, "FrameData must match the std140 layout of the GLSL block");
+
+	// A ring of FrameData regions in one persistently mapped buffer. Each
+	// Update writes the next region and binds it, fencing the regions still
+	// read by in-flight frames so the CPU never overwrites them.
+	class FrameUniformBuffer
+	{
+	public:
+		static constexpr uint32_t BindingPoint = 0;
+		static constexpr const char* BlockName = "FrameData";
+		static constexpr uint32_t RegionCount = 3;
+
+		FrameUniformBuffer() = default;
+		~FrameUniformBuffer();
+
+		FrameUniformBuffer(const FrameUniformBuffer&) = delete;
+		FrameUniformBuffer& operator=(const FrameUniformBuffer&) = delete;
+
+		// Must be called on the GL context thread, once per frame before any
+		// draw that reads the block. FrameIndex is filled in here.
+		void Update(const FrameData& data);
+
+		GLuint GetRendererID() const { return m_RendererID; }
+		uint32_t GetFrameIndex() const { return m_FrameIndex; }
+	private:
+		void Create();
+	private:
+		GLuint m_RendererID = 0;
+		uint8_t* m_Mapped = nullptr;
+		uint32_t m_Stride = 0;
+
+		std::array<GLsync, RegionCount> m_Fences = {};
+		uint32_t m_Region = 0;
+		uint32_t m_FrameIndex = 0;
+	};
+
+}
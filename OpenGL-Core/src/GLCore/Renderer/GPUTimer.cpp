@@ -0,0 +1,56 @@
+#include "glpch.h"
+#include "GPUTimer.h"
+
+#include <glad/glad.h>
+
+namespace GLCore {
+
+	static_assert(sizeof(GLuint) == sizeof(uint32_t), "GPUTimer stores query names as uint32_t");
+
+	GPUTimer::~GPUTimer()
+	{
+		if (m_Queries[0])
+			glDeleteQueries(QueryCount, m_Queries.data());
+	}
+
+	void GPUTimer::Begin()
+	{
+		if (!m_Queries[0])
+			glCreateQueries(GL_TIME_ELAPSED, QueryCount, m_Queries.data());
+
+		// Ring is full: drop the oldest unread result rather than block
+		if (m_WriteIndex - m_ReadIndex == QueryCount)
+			m_ReadIndex++;
+
+		glBeginQuery(GL_TIME_ELAPSED, m_Queries[m_WriteIndex % QueryCount]);
+	}
+
+	void GPUTimer::End()
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+		m_WriteIndex++;
+	}
+
+	bool GPUTimer::Poll()
+	{
+		bool updated = false;
+		while (m_ReadIndex != m_WriteIndex)
+		{
+			GLuint query = m_Queries[m_ReadIndex % QueryCount];
+
+			GLint available = GL_FALSE;
+			glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available)
+				break;
+
+			GLuint64 nanoseconds = 0;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+			m_ElapsedTime = (float)((double)nanoseconds / 1000000.0);
+			m_ReadIndex++;
+			updated = true;
+		}
+
+		return updated;
+	}
+
+}
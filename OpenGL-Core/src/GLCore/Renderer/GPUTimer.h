@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace GLCore {
+
+	// Measures GPU time between Begin and End with a ring of
+	// GL_TIME_ELAPSED queries. Results are read a few frames later, once
+	// available, so the CPU never stalls waiting for the GPU.
+	class GPUTimer
+	{
+	public:
+		static constexpr uint32_t QueryCount = 4;
+
+		GPUTimer() = default;
+		~GPUTimer();
+
+		GPUTimer(const GPUTimer&) = delete;
+		GPUTimer& operator=(const GPUTimer&) = delete;
+
+		// Must be called on the GL context thread; queries cannot nest
+		void Begin();
+		void End();
+
+		// Collects finished queries; returns true if a new result arrived
+		bool Poll();
+
+		// Most recent result in milliseconds
+		float GetElapsedTime() const { return m_ElapsedTime; }
+	private:
+		std::array<uint32_t, QueryCount> m_Queries = {};
+		uint32_t m_WriteIndex = 0, m_ReadIndex = 0;
+		float m_ElapsedTime = 0.0f;
+	};
+
+}
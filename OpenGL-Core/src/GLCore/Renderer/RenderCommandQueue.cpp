@@ -0,0 +1,168 @@
+#include "glpch.h"
+#include "RenderCommandQueue.h"
+
+#include "GLCore/Core/JobSystem.h"
+#include "GLCore/Util/Shader.h"
+
+#include <glm/gtc/type_ptr.hpp>
+
+namespace GLCore {
+
+	uint64_t MakeSortKey(GLuint shader, GLuint texture, float depth)
+	{
+		uint64_t quantizedDepth = (uint64_t)(glm::clamp(depth, 0.0f, 1.0f) * (float)0xFFFFFF);
+		return ((uint64_t)(shader & 0xFFF) << 52) | ((uint64_t)(texture & 0xFFF) << 40) | (quantizedDepth << 16);
+	}
+
+	RenderCommandQueue::RenderCommandQueue()
+		: m_ThreadBuffers(JobSystem::GetThreadCount())
+	{
+	}
+
+	void RenderCommandQueue::Submit(const DrawCommand& command)
+	{
+		// InvalidThreadIndex fails the range check as well
+		uint32_t threadIndex = JobSystem::GetThreadIndex();
+		if (threadIndex < m_ThreadBuffers.size())
+		{
+			m_ThreadBuffers[threadIndex].Commands.push_back(command);
+			return;
+		}
+
+		std::scoped_lock<std::mutex> lock(m_SharedMutex);
+		m_SharedCommands.push_back(command);
+	}
+
+	size_t RenderCommandQueue::GetCommandCount() const
+	{
+		size_t count = m_SharedCommands.size();
+		for (const ThreadBuffer& buffer : m_ThreadBuffers)
+			count += buffer.Commands.size();
+		return count;
+	}
+
+	void RenderCommandQueue::Clear()
+	{
+		for (ThreadBuffer& buffer : m_ThreadBuffers)
+			buffer.Commands.clear();
+		m_SharedCommands.clear();
+
+		// Pick up a resized job system between frames
+		if (m_ThreadBuffers.size() != JobSystem::GetThreadCount())
+			m_ThreadBuffers.resize(JobSystem::GetThreadCount());
+	}
+
+	// LSD radix sort of (key, index) pairs, 8 bits per pass. Passes where
+	// every key has the same digit are skipped, which removes most of them
+	// for typical scenes with few shaders and textures.
+	void RenderCommandQueue::Sort()
+	{
+		size_t count = m_Merged.size();
+		m_Keys.resize(count);
+		m_KeysScratch.resize(count);
+		m_Order.resize(count);
+		m_OrderScratch.resize(count);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			m_Keys[i] = m_Merged[i].SortKey;
+			m_Order[i] = (uint32_t)i;
+		}
+
+		for (uint32_t shift = 0; shift < 64; shift += 8)
+		{
+			uint32_t histogram[256] = {};
+			for (size_t i = 0; i < count; i++)
+				histogram[(m_Keys[i] >> shift) & 0xFF]++;
+
+			if (histogram[(m_Keys[0] >> shift) & 0xFF] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t& bucket : histogram)
+			{
+				uint32_t bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (size_t i = 0; i < count; i++)
+			{
+				uint32_t destination = histogram[(m_Keys[i] >> shift) & 0xFF]++;
+				m_KeysScratch[destination] = m_Keys[i];
+				m_OrderScratch[destination] = m_Order[i];
+			}
+
+			m_Keys.swap(m_KeysScratch);
+			m_Order.swap(m_OrderScratch);
+		}
+	}
+
+	void RenderCommandQueue::Execute()
+	{
+		m_Merged.clear();
+		m_Merged.reserve(GetCommandCount());
+		for (const ThreadBuffer& buffer : m_ThreadBuffers)
+			m_Merged.insert(m_Merged.end(), buffer.Commands.begin(), buffer.Commands.end());
+		m_Merged.insert(m_Merged.end(), m_SharedCommands.begin(), m_SharedCommands.end());
+
+		m_LastDrawCalls = 0;
+		m_LastStateChanges = 0;
+		if (m_Merged.empty())
+			return;
+
+		Sort();
+
+		// Sentinels so the first command always binds, even GL name 0
+		const GLuint unbound = 0xFFFFFFFF;
+		GLuint boundTexture = unbound, boundVertexArray = unbound;
+		Utils::Shader* boundShader = nullptr;
+		const Utils::ShaderDrawUniforms* uniforms = nullptr;
+
+		for (uint32_t index : m_Order)
+		{
+			const DrawCommand& command = m_Merged[index];
+			GLCORE_ASSERT(command.Shader, "DrawCommand without a shader!");
+
+			if (command.Shader != boundShader)
+			{
+				boundShader = command.Shader;
+				glUseProgram(boundShader->GetRendererID());
+
+				// Uniforms are program state, so an unchanged camera needs no upload
+				Utils::ShaderDrawUniforms& shaderUniforms = boundShader->GetDrawUniforms();
+				uniforms = &shaderUniforms;
+				bool upToDate = m_ViewProjectionVersion != 0 && shaderUniforms.ViewProjectionVersion == m_ViewProjectionVersion;
+				if (shaderUniforms.ViewProjection != -1 && !upToDate)
+				{
+					glUniformMatrix4fv(shaderUniforms.ViewProjection, 1, GL_FALSE, glm::value_ptr(m_ViewProjection));
+					shaderUniforms.ViewProjectionVersion = m_ViewProjectionVersion;
+				}
+				m_LastStateChanges++;
+			}
+
+			if (command.Texture != boundTexture)
+			{
+				boundTexture = command.Texture;
+				glBindTextureUnit(0, boundTexture);
+				m_LastStateChanges++;
+			}
+
+			if (command.VertexArray != boundVertexArray)
+			{
+				boundVertexArray = command.VertexArray;
+				glBindVertexArray(boundVertexArray);
+				m_LastStateChanges++;
+			}
+
+			if (uniforms->Transform != -1)
+				glUniformMatrix4fv(uniforms->Transform, 1, GL_FALSE, glm::value_ptr(command.Transform));
+			if (uniforms->Color != -1)
+				glUniform4fv(uniforms->Color, 1, glm::value_ptr(command.Color));
+
+			glDrawElements(GL_TRIANGLES, command.IndexCount, GL_UNSIGNED_INT, nullptr);
+			m_LastDrawCalls++;
+		}
+	}
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <mutex>
+#include <vector>
+
+namespace GLCore {
+
+	namespace Utils {
+		class Shader;
+	}
+
+	// One indexed draw. Everything the render thread needs is baked in at
+	// record time so Execute() only binds state and issues the call.
+	struct DrawCommand
+	{
+		uint64_t SortKey = 0;
+
+		Utils::Shader* Shader = nullptr; // Must outlive the Execute() that draws it
+		GLuint VertexArray = 0;
+		GLuint Texture = 0;
+		uint32_t IndexCount = 0;
+
+		glm::mat4 Transform = glm::mat4(1.0f);
+		glm::vec4 Color = { 1.0f, 1.0f, 1.0f, 1.0f };
+	};
+
+	// Sort key layout, most significant first:
+	//   [63..52] shader   [51..40] texture   [39..16] depth   [15..0] unused
+	// Depth is expected in [0, 1] and sorted front to back.
+	uint64_t MakeSortKey(GLuint shader, GLuint texture, float depth);
+
+	// Collects draw commands from any job system thread into per-thread
+	// linear buffers, then merges, sorts and executes them on the thread that
+	// owns the GL context. Threads without a buffer of their own (outside the
+	// job system, or workers of a job system started after the queue was
+	// built or last cleared) share a locked one.
+	//
+	// Shaders drawn through the queue may declare
+	//   uniform mat4 u_ViewProjection, u_Transform; uniform vec4 u_Color;
+	// uniforms they do not declare are skipped. Shaders that read the camera
+	// from the FrameData block (see FrameUniformBuffer) need no
+	// SetViewProjection.
+	class RenderCommandQueue
+	{
+	public:
+		RenderCommandQueue();
+
+		// With a non-zero version (e.g. OrthographicCamera::GetVersion()) the
+		// matrix is only re-uploaded to programs that have not seen that version
+		void SetViewProjection(const glm::mat4& viewProjection, uint64_t version = 0) { m_ViewProjection = viewProjection; m_ViewProjectionVersion = version; }
+
+		// Safe to call concurrently from any thread
+		void Submit(const DrawCommand& command);
+
+		// Must be called on the GL context thread once recording has joined
+		void Execute();
+		void Clear();
+
+		size_t GetCommandCount() const;
+		uint32_t GetLastDrawCallCount() const { return m_LastDrawCalls; }
+		uint32_t GetLastStateChangeCount() const { return m_LastStateChanges; }
+	private:
+		void Sort();
+	private:
+		struct alignas(64) ThreadBuffer
+		{
+			std::vector<DrawCommand> Commands;
+		};
+
+		std::vector<ThreadBuffer> m_ThreadBuffers;
+		std::mutex m_SharedMutex;
+		std::vector<DrawCommand> m_SharedCommands;
+		std::vector<DrawCommand> m_Merged;
+		std::vector<uint64_t> m_Keys, m_KeysScratch;
+		std::vector<uint32_t> m_Order, m_OrderScratch;
+
+		glm::mat4 m_ViewProjection = glm::mat4(1.0f);
+		uint64_t m_ViewProjectionVersion = 0;
+		uint32_t m_LastDrawCalls = 0, m_LastStateChanges = 0;
+	};
+
+}
@@ -0,0 +1,105 @@
+#include "glpch.h"
+#include "RenderThread.h"
+
+#include "GLCore/Core/Profile.h"
+
+#include <GLFW/glfw3.h>
+
+namespace GLCore {
+
+	RenderThread::~RenderThread()
+	{
+		Stop();
+	}
+
+	void RenderThread::Start(Window& window, uint32_t maxFrameLatency)
+	{
+		GLCORE_ASSERT(!IsRunning(), "RenderThread already running!");
+
+		m_Window = &window;
+		m_MaxFrameLatency = std::max(1u, maxFrameLatency);
+		m_StopRequested = false;
+
+		// The context can only be current on one thread at a time
+		glfwMakeContextCurrent(nullptr);
+		m_Thread = std::thread(&RenderThread::ThreadLoop, this);
+	}
+
+	void RenderThread::Stop()
+	{
+		if (!IsRunning())
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_StopRequested = true;
+		}
+		m_FrameQueued.notify_one();
+		m_Thread.join();
+
+		// Hand the context back so shutdown code on the main thread can use GL
+		glfwMakeContextCurrent((GLFWwindow*)m_Window->GetNativeWindow());
+		m_Recording.clear();
+	}
+
+	void RenderThread::EndFrame(double inputTime)
+	{
+		// Includes waiting for a frame to retire
+		GLCORE_PROFILE_FUNCTION();
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_FrameRetired.wait(lock, [this]() { return m_FramesInFlight < m_MaxFrameLatency; });
+
+		m_Queue.push_back({ std::move(m_Recording), inputTime });
+		m_FramesInFlight++;
+		m_Recording.clear();
+
+		lock.unlock();
+		m_FrameQueued.notify_one();
+	}
+
+	void RenderThread::ThreadLoop()
+	{
+		glfwMakeContextCurrent((GLFWwindow*)m_Window->GetNativeWindow());
+
+		while (true)
+		{
+			Frame frame;
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_FrameQueued.wait(lock, [this]() { return !m_Queue.empty() || m_StopRequested; });
+
+				// Frames already handed over are still presented before stopping
+				if (m_Queue.empty())
+					break;
+
+				frame = std::move(m_Queue.front());
+				m_Queue.pop_front();
+			}
+
+			{
+				GLCORE_PROFILE_SCOPE("RenderThread::Frame");
+				for (RenderFunction& command : frame.Commands)
+					command();
+
+				m_Window->SwapBuffers();
+			}
+
+			if (frame.InputTime >= 0.0)
+			{
+				float latency = (float)((glfwGetTime() - frame.InputTime) * 1000.0);
+				m_InputLatency = latency;
+				m_AverageInputLatency = m_AverageInputLatency.load() * 0.9f + latency * 0.1f;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_FramesInFlight--;
+			}
+			m_FrameRetired.notify_one();
+		}
+
+		glfwMakeContextCurrent(nullptr);
+	}
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "GLCore/Core/Window.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace GLCore {
+
+	// Owns the GL context on a dedicated thread and replays frames recorded
+	// on the main thread. The main thread may run at most maxFrameLatency
+	// frames ahead of the frame being presented; EndFrame blocks beyond that.
+	// A latency of 1 is the classic two-frame pipeline: the main thread
+	// updates frame N+1 while the render thread submits frame N.
+	class RenderThread
+	{
+	public:
+		using RenderFunction = std::function<void()>;
+
+		RenderThread() = default;
+		~RenderThread();
+
+		void Start(Window& window, uint32_t maxFrameLatency = 1);
+		void Stop();
+		bool IsRunning() const { return m_Thread.joinable(); }
+
+		// Main thread: append to the frame currently being recorded
+		void Submit(RenderFunction function) { m_Recording.push_back(std::move(function)); }
+
+		// Main thread: hand the recorded frame over. inputTime is the
+		// glfwGetTime() of the oldest input event the frame reacted to, or a
+		// negative value if there was none.
+		void EndFrame(double inputTime);
+
+		uint32_t GetMaxFrameLatency() const { return m_MaxFrameLatency; }
+
+		// Input-to-present latency of the last frame that carried input, and a
+		// smoothed average, in milliseconds
+		float GetInputLatency() const { return m_InputLatency.load(); }
+		float GetAverageInputLatency() const { return m_AverageInputLatency.load(); }
+	private:
+		struct Frame
+		{
+			std::vector<RenderFunction> Commands;
+			double InputTime = -1.0;
+		};
+
+		void ThreadLoop();
+	private:
+		Window* m_Window = nullptr;
+		std::thread m_Thread;
+		uint32_t m_MaxFrameLatency = 1;
+
+		std::vector<RenderFunction> m_Recording;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_FrameQueued, m_FrameRetired;
+		std::deque<Frame> m_Queue;
+		uint32_t m_FramesInFlight = 0;
+		bool m_StopRequested = false;
+
+		std::atomic<float> m_InputLatency = 0.0f, m_AverageInputLatency = 0.0f;
+	};
+
+}
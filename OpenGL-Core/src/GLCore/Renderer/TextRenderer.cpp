@@ -0,0 +1,224 @@
+#include "glpch.h"
+#include "TextRenderer.h"
+
+#include "GLCore/Util/Shader.h"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <cstddef>
+
+namespace GLCore {
+
+	static const char* s_VertexSource = R"(
+		#version 450 core
+
+		layout (location = 0) in vec4 a_Rect;
+		layout (location = 1) in vec4 a_UVRect;
+		layout (location = 2) in float a_Depth;
+		layout (location = 3) in vec4 a_Color;
+
+		uniform mat4 u_ViewProjection;
+
+		out vec2 v_TexCoord;
+		out vec4 v_Color;
+
+		void main()
+		{
+			// Strip order: bottom left, bottom right, top left, top right
+			vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+			v_TexCoord = mix(a_UVRect.xy, a_UVRect.zw, corner);
+			v_Color = a_Color;
+			gl_Position = u_ViewProjection * vec4(mix(a_Rect.xy, a_Rect.zw, corner), a_Depth, 1.0);
+		}
+	)";
+
+	static const char* s_FragmentSource = R"(
+		#version 450 core
+
+		in vec2 v_TexCoord;
+		in vec4 v_Color;
+
+		uniform sampler2D u_Atlas;
+
+		layout (location = 0) out vec4 o_Color;
+
+		void main()
+		{
+			// 0.5 is the outline; blend over roughly one screen pixel at any scale
+			float distance = texture(u_Atlas, v_TexCoord).r;
+			float width = max(fwidth(distance) * 0.7, 1e-5);
+			float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+			if (alpha <= 0.0)
+				discard;
+
+			o_Color = vec4(v_Color.rgb, v_Color.a * alpha);
+		}
+	)";
+
+	static uint64_t HashLayoutKey(uint64_t fontID, std::string_view text)
+	{
+		uint64_t hash = 0xCBF29CE484222325ull ^ (fontID * 0x9E3779B97F4A7C15ull);
+		for (char c : text)
+		{
+			hash ^= (uint8_t)c;
+			hash *= 0x100000001B3ull;
+		}
+		return hash;
+	}
+
+	static uint32_t PackColor(const glm::vec4& color)
+	{
+		glm::uvec4 bytes = glm::uvec4(glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f);
+		return bytes.r | bytes.g << 8 | bytes.b << 16 | bytes.a << 24;
+	}
+
+	TextRenderer::~TextRenderer()
+	{
+		glDeleteVertexArrays(1, &m_VertexArray);
+		glDeleteBuffers(1, &m_InstanceBuffer);
+	}
+
+	void TextRenderer::Create()
+	{
+		m_Shader.reset(Utils::Shader::FromGLSLSource(s_VertexSource, s_FragmentSource));
+		m_ViewProjectionLocation = glGetUniformLocation(m_Shader->GetRendererID(), "u_ViewProjection");
+
+		glCreateBuffers(1, &m_InstanceBuffer);
+		glCreateVertexArrays(1, &m_VertexArray);
+		glVertexArrayVertexBuffer(m_VertexArray, 0, m_InstanceBuffer, 0, sizeof(GlyphInstance));
+		glVertexArrayBindingDivisor(m_VertexArray, 0, 1);
+
+		auto addAttribute = [this](GLuint location, GLint components, GLenum type, GLboolean normalized, size_t offset)
+		{
+			glEnableVertexArrayAttrib(m_VertexArray, location);
+			glVertexArrayAttribFormat(m_VertexArray, location, components, type, normalized, (GLuint)offset);
+			glVertexArrayAttribBinding(m_VertexArray, location, 0);
+		};
+		addAttribute(0, 4, GL_FLOAT, GL_FALSE, offsetof(GlyphInstance, Rect));
+		addAttribute(1, 4, GL_FLOAT, GL_FALSE, offsetof(GlyphInstance, UVRect));
+		addAttribute(2, 1, GL_FLOAT, GL_FALSE, offsetof(GlyphInstance, Depth));
+		addAttribute(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(GlyphInstance, Color));
+	}
+
+	void TextRenderer::Begin(const glm::mat4& viewProjection)
+	{
+		m_ViewProjection = viewProjection;
+	}
+
+	const Utils::TextLayout& TextRenderer::GetLayout(const Utils::Font& font, std::string_view text)
+	{
+		uint64_t hash = HashLayoutKey(font.GetID(), text);
+		CachedLayout& entry = m_Layouts[hash];
+		entry.LastUsed = m_Frame;
+
+		// A hash collision simply replaces the older entry
+		if (entry.FontID == font.GetID() && entry.Text == text)
+		{
+			m_FrameStats.LayoutCacheHits++;
+			return entry.Layout;
+		}
+
+		m_FrameStats.LayoutCacheMisses++;
+		entry.FontID = font.GetID();
+		entry.Text.assign(text);
+		font.LayoutText(text, entry.Layout);
+		return entry.Layout;
+	}
+
+	void TextRenderer::DrawString(const Utils::Font& font, std::string_view text, const glm::vec3& position, float size, const glm::vec4& color)
+	{
+		DrawLayout(font, GetLayout(font, text), position, size, color);
+	}
+
+	void TextRenderer::DrawLayout(const Utils::Font& font, const Utils::TextLayout& layout, const glm::vec3& position, float size, const glm::vec4& color)
+	{
+		if (layout.Glyphs.empty())
+			return;
+
+		FontBatch* batch = nullptr;
+		for (uint32_t i = 0; i < m_ActiveBatches && !batch; i++)
+		{
+			if (m_Batches[i].Font == &font)
+				batch = &m_Batches[i];
+		}
+		if (!batch)
+		{
+			if (m_ActiveBatches == m_Batches.size())
+				m_Batches.emplace_back();
+			batch = &m_Batches[m_ActiveBatches++];
+			batch->Font = &font;
+		}
+
+		size_t first = batch->Glyphs.size();
+		batch->Glyphs.resize(first + layout.Glyphs.size());
+		GlyphInstance* instance = batch->Glyphs.data() + first;
+
+		glm::vec2 origin = { position.x, position.y };
+		uint32_t packedColor = PackColor(color);
+		for (const Utils::TextLayoutGlyph& glyph : layout.Glyphs)
+		{
+			instance->Rect = glm::vec4(origin + glyph.PlaneMin * size, origin + glyph.PlaneMax * size);
+			instance->UVRect = glm::vec4(glyph.UVMin, glyph.UVMax);
+			instance->Depth = position.z;
+			instance->Color = packedColor;
+			instance++;
+		}
+
+		m_FrameStats.Glyphs += (uint32_t)layout.Glyphs.size();
+	}
+
+	void TextRenderer::Flush()
+	{
+		if (m_ActiveBatches == 0)
+			return;
+
+		if (!m_Shader)
+			Create();
+
+		glUseProgram(m_Shader->GetRendererID());
+		glUniformMatrix4fv(m_ViewProjectionLocation, 1, GL_FALSE, glm::value_ptr(m_ViewProjection));
+		glBindVertexArray(m_VertexArray);
+
+		for (uint32_t i = 0; i < m_ActiveBatches; i++)
+		{
+			FontBatch& batch = m_Batches[i];
+			glBindTextureUnit(0, batch.Font->GetAtlasRendererID());
+
+			for (size_t offset = 0; offset < batch.Glyphs.size(); offset += MaxGlyphsPerDraw)
+			{
+				// Respecifying the store orphans the one the previous draw reads
+				GLsizei count = (GLsizei)std::min<size_t>(MaxGlyphsPerDraw, batch.Glyphs.size() - offset);
+				glNamedBufferData(m_InstanceBuffer, count * sizeof(GlyphInstance), batch.Glyphs.data() + offset, GL_STREAM_DRAW);
+				glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count);
+				m_FrameStats.DrawCalls++;
+			}
+
+			batch.Glyphs.clear();
+			batch.Font = nullptr;
+		}
+		m_ActiveBatches = 0;
+	}
+
+	void TextRenderer::End()
+	{
+		Flush();
+
+		// Scanning the cache every frame would cost more than the layouts it frees
+		if (m_Frame % 16 == 0)
+		{
+			for (auto it = m_Layouts.begin(); it != m_Layouts.end();)
+			{
+				if (m_Frame - it->second.LastUsed > m_LayoutLifetime)
+					it = m_Layouts.erase(it);
+				else
+					++it;
+			}
+		}
+		m_Frame++;
+
+		m_Stats = m_FrameStats;
+		m_Stats.CachedLayouts = (uint32_t)m_Layouts.size();
+		m_FrameStats = TextRendererStats();
+	}
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "GLCore/Util/Font.h"
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace GLCore {
+
+	namespace Utils {
+		class Shader;
+	}
+
+	struct TextRendererStats
+	{
+		uint32_t Glyphs = 0;
+		uint32_t DrawCalls = 0;
+		uint32_t LayoutCacheHits = 0;
+		uint32_t LayoutCacheMisses = 0;
+		uint32_t CachedLayouts = 0;
+	};
+
+	// Batched signed distance field text. Strings are shaped once by
+	// Font::LayoutText and the layout is cached by font and text, so labels
+	// that repeat every frame only cost their glyph copies. Each glyph is
+	// one instance of a four-vertex strip; End() draws every glyph of a font
+	// in one call per MaxGlyphsPerDraw.
+	//
+	// GL context thread only. Expects alpha blending to be enabled. Strings
+	// of one font keep their submission order; fonts are drawn one after the
+	// other in the order they were first used.
+	class TextRenderer
+	{
+	public:
+		static constexpr uint32_t MaxGlyphsPerDraw = 1 << 16;
+
+		TextRenderer() = default;
+		~TextRenderer();
+
+		TextRenderer(const TextRenderer&) = delete;
+		TextRenderer& operator=(const TextRenderer&) = delete;
+
+		void Begin(const glm::mat4& viewProjection);
+		// position is the left end of the first baseline and size the font
+		// height (ascender to descender) in world units; the text is laid out
+		// in the XY plane at position.z
+		void DrawString(const Utils::Font& font, std::string_view text, const glm::vec3& position, float size, const glm::vec4& color);
+		void DrawLayout(const Utils::Font& font, const Utils::TextLayout& layout, const glm::vec3& position, float size, const glm::vec4& color);
+		void End();
+
+		// Cached layout of text, e.g. to measure it before drawing; valid
+		// until the next GetLayout(), DrawString() or End()
+		const Utils::TextLayout& GetLayout(const Utils::Font& font, std::string_view text);
+
+		// Layouts not used for this many End() calls are dropped
+		void SetLayoutCacheLifetime(uint32_t frames) { m_LayoutLifetime = frames; }
+		void ClearLayoutCache() { m_Layouts.clear(); }
+
+		const TextRendererStats& GetStats() const { return m_Stats; }
+	private:
+		void Create();
+		void Flush();
+	private:
+		// Per-instance vertex data, see the vertex shader in TextRenderer.cpp
+		struct GlyphInstance
+		{
+			glm::vec4 Rect;   // Min xy, max xy
+			glm::vec4 UVRect; // Min uv, max uv
+			float Depth;
+			uint32_t Color;   // RGBA8
+		};
+
+		struct FontBatch
+		{
+			const Utils::Font* Font = nullptr;
+			std::vector<GlyphInstance> Glyphs;
+		};
+
+		struct CachedLayout
+		{
+			uint64_t FontID = 0;
+			std::string Text;
+			Utils::TextLayout Layout;
+			uint64_t LastUsed = 0;
+		};
+
+		std::unique_ptr<Utils::Shader> m_Shader;
+		GLint m_ViewProjectionLocation = -1;
+		GLuint m_VertexArray = 0;
+		GLuint m_InstanceBuffer = 0;
+
+		glm::mat4 m_ViewProjection = glm::mat4(1.0f);
+		std::vector<FontBatch> m_Batches; // Kept across frames for their capacity
+		uint32_t m_ActiveBatches = 0;
+
+		std::unordered_map<uint64_t, CachedLayout> m_Layouts; // By hash of font and text
+		uint64_t m_Frame = 0;
+		uint32_t m_LayoutLifetime = 120;
+
+		TextRendererStats m_Stats, m_FrameStats;
+	};
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace GLCore {
+
+	struct TransformComponent
+	{
+		glm::vec3 Position = { 0.0f, 0.0f, 0.0f };
+		float Rotation = 0.0f; // In degrees, anti-clockwise
+		glm::vec2 Scale = { 1.0f, 1.0f };
+	};
+
+	struct VelocityComponent
+	{
+		glm::vec3 Linear = { 0.0f, 0.0f, 0.0f };
+		float Angular = 0.0f;
+	};
+
+	struct SpriteRendererComponent
+	{
+		glm::vec4 Color = { 1.0f, 1.0f, 1.0f, 1.0f };
+	};
+
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace GLCore {
+
+	// Stable handle into a Registry. The index addresses the sparse arrays,
+	// the version is bumped every time the index is recycled so handles to
+	// destroyed entities can be detected instead of silently aliasing.
+	struct Entity
+	{
+		static constexpr uint32_t NullIndex = 0xFFFFFFFF;
+
+		uint32_t Index = NullIndex;
+		uint32_t Version = 0;
+
+		Entity() = default;
+		Entity(uint32_t index, uint32_t version)
+			: Index(index), Version(version) {}
+
+		bool operator==(const Entity& other) const { return Index == other.Index && Version == other.Version; }
+		bool operator!=(const Entity& other) const { return !(*this == other); }
+
+		explicit operator bool() const { return Index != NullIndex; }
+	};
+
+}
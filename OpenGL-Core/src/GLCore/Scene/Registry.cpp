@@ -0,0 +1,62 @@
+#include "glpch.h"
+#include "Registry.h"
+
+namespace GLCore {
+
+	Entity Registry::Create()
+	{
+		if (!m_FreeList.empty())
+		{
+			uint32_t index = m_FreeList.back();
+			m_FreeList.pop_back();
+			return { index, m_Versions[index] };
+		}
+
+		m_Versions.push_back(0);
+		return { (uint32_t)m_Versions.size() - 1, 0 };
+	}
+
+	void Registry::Destroy(Entity entity)
+	{
+		GLCORE_ASSERT(Valid(entity), "Invalid entity!");
+
+		for (auto& pool : m_Pools)
+		{
+			if (pool && pool->Contains(entity))
+				pool->Remove(entity);
+		}
+
+		m_Versions[entity.Index]++;
+		m_FreeList.push_back(entity.Index);
+	}
+
+	bool Registry::Valid(Entity entity) const
+	{
+		return entity.Index < m_Versions.size() && m_Versions[entity.Index] == entity.Version;
+	}
+
+	void Registry::Reserve(size_t capacity)
+	{
+		m_Versions.reserve(capacity);
+	}
+
+	void Registry::Clear()
+	{
+		m_Pools.clear();
+
+		// Versions survive, so handles from before Clear() stay invalid; the
+		// free list already holds bumped indices, every other one is bumped now
+		std::vector<bool> free(m_Versions.size(), false);
+		for (uint32_t index : m_FreeList)
+			free[index] = true;
+
+		m_FreeList.clear();
+		for (uint32_t index = (uint32_t)m_Versions.size(); index-- > 0;)
+		{
+			if (!free[index])
+				m_Versions[index]++;
+			m_FreeList.push_back(index);
+		}
+	}
+
+}
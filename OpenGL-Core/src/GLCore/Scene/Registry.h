@@ -0,0 +1,161 @@
+#pragma once
+
+#include "GLCore/Core/Core.h"
+
+#include "Entity.h"
+#include "SparseSet.h"
+
+#include <tuple>
+
+namespace GLCore {
+
+	namespace Internal {
+
+		inline uint32_t NextComponentTypeID()
+		{
+			static uint32_t s_Counter = 0;
+			return s_Counter++;
+		}
+
+		template<typename T>
+		uint32_t ComponentTypeID()
+		{
+			static const uint32_t s_ID = NextComponentTypeID();
+			return s_ID;
+		}
+
+	}
+
+	class Registry;
+
+	// Iterates every entity that owns all of the listed components. The
+	// smallest pool drives the iteration, the others are only probed.
+	template<typename... Types>
+	class View
+	{
+	public:
+		View(ComponentPool<Types>*... pools)
+			: m_Pools(pools...)
+		{
+			for (SparseSet* pool : { static_cast<SparseSet*>(pools)... })
+			{
+				if (!m_Driver || pool->Size() < m_Driver->Size())
+					m_Driver = pool;
+			}
+		}
+
+		// func(Entity, Types&...)
+		template<typename F>
+		void Each(F&& func)
+		{
+			if constexpr (sizeof...(Types) == 1)
+			{
+				// Single component: walk the dense arrays directly, no probing
+				auto* pool = std::get<0>(m_Pools);
+				const Entity* entities = pool->Entities();
+				auto* components = pool->Components();
+				for (size_t i = 0, count = pool->Size(); i < count; i++)
+					func(entities[i], components[i]);
+			}
+			else
+			{
+				const Entity* entities = m_Driver->Entities();
+				for (size_t i = 0, count = m_Driver->Size(); i < count; i++)
+				{
+					Entity entity = entities[i];
+					if ((std::get<ComponentPool<Types>*>(m_Pools)->Contains(entity) && ...))
+						func(entity, std::get<ComponentPool<Types>*>(m_Pools)->Get(entity)...);
+				}
+			}
+		}
+
+		size_t SizeHint() const { return m_Driver->Size(); }
+	private:
+		std::tuple<ComponentPool<Types>*...> m_Pools;
+		SparseSet* m_Driver = nullptr;
+	};
+
+	class Registry
+	{
+	public:
+		Registry() = default;
+		Registry(const Registry&) = delete;
+		Registry& operator=(const Registry&) = delete;
+
+		Entity Create();
+		void Destroy(Entity entity);
+		bool Valid(Entity entity) const;
+		void Reserve(size_t capacity);
+		// Destroys every entity; handles from before stay invalid
+		void Clear();
+
+		size_t Alive() const { return m_Versions.size() - m_FreeList.size(); }
+
+		template<typename T, typename... Args>
+		T& Emplace(Entity entity, Args&&... args)
+		{
+			GLCORE_ASSERT(Valid(entity), "Invalid entity!");
+			GLCORE_ASSERT(!Has<T>(entity), "Entity already has component!");
+			return Pool<T>()->Emplace(entity, std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		void Remove(Entity entity)
+		{
+			GLCORE_ASSERT(Has<T>(entity), "Entity does not have component!");
+			Pool<T>()->Remove(entity);
+		}
+
+		template<typename T>
+		bool Has(Entity entity) const
+		{
+			const SparseSet* pool = FindPool(Internal::ComponentTypeID<T>());
+			return pool && pool->Contains(entity);
+		}
+
+		template<typename T>
+		T& Get(Entity entity)
+		{
+			GLCORE_ASSERT(Has<T>(entity), "Entity does not have component!");
+			return Pool<T>()->Get(entity);
+		}
+
+		template<typename T>
+		T* TryGet(Entity entity)
+		{
+			SparseSet* pool = FindPool(Internal::ComponentTypeID<T>());
+			return pool ? static_cast<ComponentPool<T>*>(pool)->TryGet(entity) : nullptr;
+		}
+
+		template<typename... Types>
+		GLCore::View<Types...> View()
+		{
+			return GLCore::View<Types...>(Pool<Types>()...);
+		}
+
+		// Direct access to the packed storage of a component type
+		template<typename T>
+		ComponentPool<T>& Storage() { return *Pool<T>(); }
+	private:
+		template<typename T>
+		ComponentPool<T>* Pool()
+		{
+			uint32_t id = Internal::ComponentTypeID<T>();
+			if (id >= m_Pools.size())
+				m_Pools.resize(id + 1);
+			if (!m_Pools[id])
+				m_Pools[id] = std::make_unique<ComponentPool<T>>();
+			return static_cast<ComponentPool<T>*>(m_Pools[id].get());
+		}
+
+		SparseSet* FindPool(uint32_t id) const
+		{
+			return id < m_Pools.size() ? m_Pools[id].get() : nullptr;
+		}
+	private:
+		std::vector<std::unique_ptr<SparseSet>> m_Pools;
+		std::vector<uint32_t> m_Versions;
+		std::vector<uint32_t> m_FreeList;
+	};
+
+}
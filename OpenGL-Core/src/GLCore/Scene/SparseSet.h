@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Entity.h"
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace GLCore {
+
+	// Maps entity indices to positions in a tightly packed dense array.
+	// The sparse side is paged so a handful of high entity indices does not
+	// allocate one slot for every index below them.
+	class SparseSet
+	{
+	public:
+		static constexpr uint32_t PageSize = 4096;
+		static constexpr uint32_t Tombstone = 0xFFFFFFFF;
+
+		virtual ~SparseSet() = default;
+
+		bool Contains(Entity entity) const
+		{
+			uint32_t dense = DenseIndex(entity.Index);
+			return dense != Tombstone && m_Dense[dense] == entity;
+		}
+
+		uint32_t DenseIndex(uint32_t index) const
+		{
+			uint32_t page = index / PageSize;
+			if (page >= m_Sparse.size() || !m_Sparse[page])
+				return Tombstone;
+			return m_Sparse[page][index % PageSize];
+		}
+
+		size_t Size() const { return m_Dense.size(); }
+		bool Empty() const { return m_Dense.empty(); }
+
+		const Entity* Entities() const { return m_Dense.data(); }
+
+		virtual void Remove(Entity entity) = 0;
+	protected:
+		uint32_t& SparseSlot(uint32_t index)
+		{
+			uint32_t page = index / PageSize;
+			if (page >= m_Sparse.size())
+				m_Sparse.resize(page + 1);
+
+			if (!m_Sparse[page])
+			{
+				m_Sparse[page] = std::make_unique<uint32_t[]>(PageSize);
+				std::fill_n(m_Sparse[page].get(), PageSize, Tombstone);
+			}
+			return m_Sparse[page][index % PageSize];
+		}
+
+		void InsertEntity(Entity entity)
+		{
+			SparseSlot(entity.Index) = (uint32_t)m_Dense.size();
+			m_Dense.push_back(entity);
+		}
+
+		// Swap-and-pop; returns the dense slot that was vacated so derived
+		// storage can mirror the move.
+		uint32_t RemoveEntity(Entity entity)
+		{
+			uint32_t dense = DenseIndex(entity.Index);
+			Entity last = m_Dense.back();
+
+			m_Dense[dense] = last;
+			SparseSlot(last.Index) = dense;
+			SparseSlot(entity.Index) = Tombstone;
+			m_Dense.pop_back();
+			return dense;
+		}
+	private:
+		std::vector<std::unique_ptr<uint32_t[]>> m_Sparse;
+		std::vector<Entity> m_Dense;
+	};
+
+	// Sparse set with a component array kept in lockstep with the dense
+	// entity array, so iterating a pool is a linear walk over T.
+	template<typename T>
+	class ComponentPool : public SparseSet
+	{
+	public:
+		template<typename... Args>
+		T& Emplace(Entity entity, Args&&... args)
+		{
+			InsertEntity(entity);
+			if constexpr (std::is_aggregate_v<T>)
+				m_Components.push_back(T{ std::forward<Args>(args)... });
+			else
+				m_Components.emplace_back(std::forward<Args>(args)...);
+			return m_Components.back();
+		}
+
+		virtual void Remove(Entity entity) override
+		{
+			uint32_t dense = RemoveEntity(entity);
+			if (dense != m_Components.size() - 1)
+				m_Components[dense] = std::move(m_Components.back());
+			m_Components.pop_back();
+		}
+
+		T& Get(Entity entity) { return m_Components[DenseIndex(entity.Index)]; }
+		const T& Get(Entity entity) const { return m_Components[DenseIndex(entity.Index)]; }
+
+		T* TryGet(Entity entity) { return Contains(entity) ? &Get(entity) : nullptr; }
+
+		T* Components() { return m_Components.data(); }
+		const T* Components() const { return m_Components.data(); }
+	private:
+		std::vector<T> m_Components;
+	};
+
+}
@@ -0,0 +1,237 @@
+#include "glpch.h"
+#include "TransformHierarchy.h"
+
+namespace GLCore {
+
+	static constexpr uint32_t s_NullSlot = 0xFFFFFFFF;
+
+	// translate * mat4_cast(rotation) * scale, written out
+	static glm::mat4 ComposeMatrix(const LocalTransform& local)
+	{
+		const glm::quat& q = local.Rotation;
+		const glm::vec3& s = local.Scale;
+		float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+		float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+		float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+		return glm::mat4(
+			(1.0f - 2.0f * (yy + zz)) * s.x, 2.0f * (xy + wz) * s.x, 2.0f * (xz - wy) * s.x, 0.0f,
+			2.0f * (xy - wz) * s.y, (1.0f - 2.0f * (xx + zz)) * s.y, 2.0f * (yz + wx) * s.y, 0.0f,
+			2.0f * (xz + wy) * s.z, 2.0f * (yz - wx) * s.z, (1.0f - 2.0f * (xx + yy)) * s.z, 0.0f,
+			local.Position.x, local.Position.y, local.Position.z, 1.0f);
+	}
+
+	TransformHierarchy::Node TransformHierarchy::Create(Node parent, const LocalTransform& local)
+	{
+		GLCORE_ASSERT(parent == NullNode || Valid(parent), "Invalid parent node!");
+
+		Node node;
+		if (!m_FreeList.empty())
+		{
+			node = m_FreeList.back();
+			m_FreeList.pop_back();
+		}
+		else
+		{
+			node = (Node)m_NodeToSlot.size();
+			m_NodeToSlot.push_back(s_NullSlot);
+		}
+
+		// Appending keeps the order valid: the parent is already in the arrays
+		uint32_t slot = (uint32_t)m_Parents.size();
+		m_NodeToSlot[node] = slot;
+		m_Parents.push_back(parent == NullNode ? s_NullSlot : m_NodeToSlot[parent]);
+		m_Locals.push_back(local);
+		m_WorldMatrices.push_back(glm::mat4(1.0f));
+		m_Flags.push_back(0);
+		m_WorldChangedStamp.push_back(0);
+		m_SlotToNode.push_back(node);
+
+		MarkDirty(slot);
+		return node;
+	}
+
+	void TransformHierarchy::Destroy(Node node)
+	{
+		m_Flags[Slot(node)] |= DestroyedFlag;
+		m_OrderDirty = true;
+	}
+
+	bool TransformHierarchy::Valid(Node node) const
+	{
+		if (node >= m_NodeToSlot.size() || m_NodeToSlot[node] == s_NullSlot)
+			return false;
+		return !(m_Flags[m_NodeToSlot[node]] & DestroyedFlag);
+	}
+
+	void TransformHierarchy::Reserve(size_t capacity)
+	{
+		m_Parents.reserve(capacity);
+		m_Locals.reserve(capacity);
+		m_WorldMatrices.reserve(capacity);
+		m_Flags.reserve(capacity);
+		m_WorldChangedStamp.reserve(capacity);
+		m_SlotToNode.reserve(capacity);
+		m_NodeToSlot.reserve(capacity);
+	}
+
+	TransformHierarchy::Node TransformHierarchy::GetParent(Node node) const
+	{
+		uint32_t parent = m_Parents[Slot(node)];
+		return parent == s_NullSlot ? NullNode : m_SlotToNode[parent];
+	}
+
+	void TransformHierarchy::SetParent(Node node, Node parent)
+	{
+		uint32_t slot = Slot(node);
+		uint32_t parentSlot = parent == NullNode ? s_NullSlot : Slot(parent);
+
+		for (uint32_t ancestor = parentSlot; ancestor != s_NullSlot; ancestor = m_Parents[ancestor])
+		{
+			if (ancestor == slot)
+			{
+				LOG_ERROR("TransformHierarchy: cannot parent a node to its own descendant");
+				return;
+			}
+		}
+
+		m_Parents[slot] = parentSlot;
+		if (parentSlot != s_NullSlot && parentSlot > slot)
+			m_OrderDirty = true;
+
+		MarkDirty(slot);
+	}
+
+	void TransformHierarchy::SetLocal(Node node, const LocalTransform& local)
+	{
+		uint32_t slot = Slot(node);
+		m_Locals[slot] = local;
+		MarkDirty(slot);
+	}
+
+	void TransformHierarchy::MarkDirty(uint32_t slot)
+	{
+		m_Flags[slot] |= DirtyFlag;
+		m_FirstDirtySlot = std::min(m_FirstDirtySlot, slot);
+	}
+
+	// Stable counting sort by depth, which puts every parent before its
+	// children, dropping destroyed subtrees on the way
+	void TransformHierarchy::Reorder()
+	{
+		const uint32_t count = (uint32_t)m_Parents.size();
+		const uint32_t unknown = 0xFFFFFFFF;
+
+		std::vector<uint32_t> depths(count, unknown);
+		std::vector<uint32_t> path;
+		uint32_t maxDepth = 0;
+		for (uint32_t slot = 0; slot < count; slot++)
+		{
+			uint32_t current = slot;
+			while (current != s_NullSlot && depths[current] == unknown)
+			{
+				path.push_back(current);
+				current = m_Parents[current];
+			}
+
+			uint32_t depth = current == s_NullSlot ? 0 : depths[current] + 1;
+			for (auto it = path.rbegin(); it != path.rend(); ++it)
+				depths[*it] = depth++;
+			path.clear();
+
+			maxDepth = std::max(maxDepth, depths[slot]);
+		}
+
+		std::vector<uint32_t> offsets(maxDepth + 2, 0);
+		for (uint32_t depth : depths)
+			offsets[depth + 1]++;
+		for (uint32_t i = 1; i < offsets.size(); i++)
+			offsets[i] += offsets[i - 1];
+
+		std::vector<uint32_t> order(count);
+		for (uint32_t slot = 0; slot < count; slot++)
+			order[offsets[depths[slot]]++] = slot;
+
+		// Parents are visited first, so destruction propagates down
+		std::vector<uint32_t> newSlots(count, s_NullSlot);
+		uint32_t kept = 0;
+		for (uint32_t oldSlot : order)
+		{
+			uint32_t parent = m_Parents[oldSlot];
+			bool destroyed = (m_Flags[oldSlot] & DestroyedFlag) || (parent != s_NullSlot && newSlots[parent] == s_NullSlot);
+			if (destroyed)
+			{
+				Node node = m_SlotToNode[oldSlot];
+				m_NodeToSlot[node] = s_NullSlot;
+				m_FreeList.push_back(node);
+				continue;
+			}
+
+			newSlots[oldSlot] = kept++;
+		}
+
+		std::vector<uint32_t> parents(kept);
+		std::vector<LocalTransform> locals(kept);
+		std::vector<glm::mat4> worldMatrices(kept);
+		std::vector<uint8_t> flags(kept);
+		std::vector<uint32_t> worldChangedStamp(kept);
+		std::vector<Node> slotToNode(kept);
+
+		m_FirstDirtySlot = s_NullSlot;
+		for (uint32_t oldSlot : order)
+		{
+			uint32_t slot = newSlots[oldSlot];
+			if (slot == s_NullSlot)
+				continue;
+
+			uint32_t parent = m_Parents[oldSlot];
+			parents[slot] = parent == s_NullSlot ? s_NullSlot : newSlots[parent];
+			locals[slot] = m_Locals[oldSlot];
+			worldMatrices[slot] = m_WorldMatrices[oldSlot];
+			flags[slot] = m_Flags[oldSlot];
+			worldChangedStamp[slot] = m_WorldChangedStamp[oldSlot];
+			slotToNode[slot] = m_SlotToNode[oldSlot];
+			m_NodeToSlot[slotToNode[slot]] = slot;
+
+			if ((flags[slot] & DirtyFlag) && m_FirstDirtySlot == s_NullSlot)
+				m_FirstDirtySlot = slot;
+		}
+
+		m_Parents.swap(parents);
+		m_Locals.swap(locals);
+		m_WorldMatrices.swap(worldMatrices);
+		m_Flags.swap(flags);
+		m_WorldChangedStamp.swap(worldChangedStamp);
+		m_SlotToNode.swap(slotToNode);
+		m_OrderDirty = false;
+	}
+
+	void TransformHierarchy::Update()
+	{
+		if (m_OrderDirty)
+			Reorder();
+
+		// A node is recomputed if its own transform changed or its parent's
+		// world matrix was recomputed earlier in this same pass
+		m_UpdateStamp++;
+		m_LastUpdatedCount = 0;
+
+		const uint32_t count = (uint32_t)m_Parents.size();
+		for (uint32_t slot = m_FirstDirtySlot; slot < count; slot++)
+		{
+			uint32_t parent = m_Parents[slot];
+			bool parentChanged = parent != s_NullSlot && m_WorldChangedStamp[parent] == m_UpdateStamp;
+			if (!(m_Flags[slot] & DirtyFlag) && !parentChanged)
+				continue;
+
+			glm::mat4 local = ComposeMatrix(m_Locals[slot]);
+			m_WorldMatrices[slot] = parent == s_NullSlot ? local : m_WorldMatrices[parent] * local;
+			m_Flags[slot] &= ~DirtyFlag;
+			m_WorldChangedStamp[slot] = m_UpdateStamp;
+			m_LastUpdatedCount++;
+		}
+
+		m_FirstDirtySlot = s_NullSlot;
+	}
+
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "GLCore/Core/Core.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <vector>
+
+namespace GLCore {
+
+	struct LocalTransform
+	{
+		glm::vec3 Position = { 0.0f, 0.0f, 0.0f };
+		glm::quat Rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+		glm::vec3 Scale = { 1.0f, 1.0f, 1.0f };
+	};
+
+	// Parent/child transforms in flat arrays kept in topological order
+	// (every parent before its children), so one forward pass computes all
+	// world matrices. Changing a local transform marks that node dirty;
+	// Update() recomputes it and its descendants only, starting at the
+	// first dirty slot.
+	//
+	// Nodes are addressed by stable IDs. Reparenting or destroying only
+	// flags the order as stale; the arrays are re-sorted and compacted at
+	// the next Update().
+	class TransformHierarchy
+	{
+	public:
+		using Node = uint32_t;
+		static constexpr Node NullNode = 0xFFFFFFFF;
+
+		TransformHierarchy() = default;
+		TransformHierarchy(const TransformHierarchy&) = delete;
+		TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+		Node Create(Node parent = NullNode, const LocalTransform& local = {});
+		// Also destroys every descendant; takes effect at the next Update()
+		void Destroy(Node node);
+		bool Valid(Node node) const;
+		void Reserve(size_t capacity);
+
+		Node GetParent(Node node) const;
+		void SetParent(Node node, Node parent);
+
+		const LocalTransform& GetLocal(Node node) const { return m_Locals[Slot(node)]; }
+		void SetLocal(Node node, const LocalTransform& local);
+
+		// As of the last Update()
+		const glm::mat4& GetWorldMatrix(Node node) const { return m_WorldMatrices[Slot(node)]; }
+
+		void Update();
+
+		// Includes nodes waiting to be destroyed
+		size_t Size() const { return m_Parents.size(); }
+		// World matrices recomputed by the last Update()
+		uint32_t GetLastUpdatedCount() const { return m_LastUpdatedCount; }
+	private:
+		uint32_t Slot(Node node) const
+		{
+			GLCORE_ASSERT(Valid(node), "Invalid transform node!");
+			return m_NodeToSlot[node];
+		}
+
+		enum NodeFlags : uint8_t
+		{
+			DirtyFlag = 1 << 0,
+			DestroyedFlag = 1 << 1
+		};
+
+		void MarkDirty(uint32_t slot);
+		void Reorder();
+	private:
+		// Indexed by slot, in topological order
+		std::vector<uint32_t> m_Parents;
+		std::vector<LocalTransform> m_Locals;
+		std::vector<glm::mat4> m_WorldMatrices;
+		std::vector<uint8_t> m_Flags;
+		std::vector<uint32_t> m_WorldChangedStamp;
+		std::vector<Node> m_SlotToNode;
+
+		// Indexed by node
+		std::vector<uint32_t> m_NodeToSlot;
+		std::vector<Node> m_FreeList;
+
+		uint32_t m_FirstDirtySlot = 0xFFFFFFFF;
+		uint32_t m_UpdateStamp = 0;
+		uint32_t m_LastUpdatedCount = 0;
+		bool m_OrderDirty = false;
+	};
+
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace GLCore::Utils {
+
+	// Shared by every camera type so a version identifies one camera state
+	// across all cameras
+	inline uint64_t NextCameraVersion()
+	{
+		static std::atomic<uint64_t> s_NextVersion = 1;
+		return s_NextVersion.fetch_add(1, std::memory_order_relaxed);
+	}
+
+}
@@ -0,0 +1,38 @@
+#include "glpch.h"
+#include "Cooker.h"
+
+#include "GLCore/FileSystem/FileSystem.h"
+
+#include <filesystem>
+
+namespace GLCore::Utils {
+
+	bool EnsureCooked(const std::string& sourcePath, const std::string& cookedSuffix, const CookFunction& cook, std::string& outCookedPath)
+	{
+		std::string physicalSourcePath;
+		if (!FileSystem::GetPhysicalPath(sourcePath, physicalSourcePath))
+		{
+			outCookedPath = sourcePath + cookedSuffix;
+			return FileSystem::Exists(outCookedPath);
+		}
+
+		std::string physicalCookedPath = physicalSourcePath + cookedSuffix;
+		std::error_code error;
+		bool stale = !std::filesystem::exists(physicalCookedPath, error)
+			|| std::filesystem::last_write_time(physicalSourcePath, error) > std::filesystem::last_write_time(physicalCookedPath, error);
+		if (stale && !cook(physicalSourcePath, physicalCookedPath))
+			return false;
+
+		outCookedPath = std::filesystem::absolute(physicalCookedPath, error).generic_string();
+		if (error)
+			outCookedPath = physicalCookedPath;
+		return true;
+	}
+
+	bool IsRangeInside(uint64_t offset, uint64_t count, uint64_t elementSize, size_t size)
+	{
+		// Divides rather than multiplies, so no field value can overflow
+		return offset <= size && (elementSize == 0 || count <= (size - offset) / elementSize);
+	}
+
+}
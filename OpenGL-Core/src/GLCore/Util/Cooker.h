@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// Shared by the asset cookers (MeshCooker, FontCooker)
+namespace GLCore::Utils {
+
+	using CookFunction = std::function<bool(const std::string& sourcePath, const std::string& cookedPath)>;
+
+	// Runs cook on sourcePath if it is a loose file and sourcePath +
+	// cookedSuffix is missing or older. Without a loose source it succeeds as
+	// long as the cooked file exists, since a shipped build may only contain
+	// that, possibly packed. outCookedPath is for FileSystem: the absolute
+	// path of the cooked file next to a loose source, so that no newer mount
+	// shadows it, otherwise the virtual path.
+	bool EnsureCooked(const std::string& sourcePath, const std::string& cookedSuffix, const CookFunction& cook, std::string& outCookedPath);
+
+	// For validating cooked files: true if count elements of elementSize
+	// bytes at offset lie within size bytes, whatever the values
+	bool IsRangeInside(uint64_t offset, uint64_t count, uint64_t elementSize, size_t size);
+
+}
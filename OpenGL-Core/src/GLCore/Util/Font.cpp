@@ -0,0 +1,206 @@
+#include "glpch.h"
+#include "Font.h"
+
+#include "GLCore/FileSystem/FileSystem.h"
+
+#include <atomic>
+
+namespace GLCore::Utils {
+
+	static std::atomic<uint64_t> s_NextFontID = 1;
+
+	// Next character of UTF-8 text; a byte that does not start a valid,
+	// shortest-form sequence is taken as a Latin-1 character on its own
+	static uint32_t DecodeCharacter(std::string_view text, size_t& position)
+	{
+		uint8_t lead = (uint8_t)text[position];
+		size_t length = (lead & 0xE0) == 0xC0 ? 2 : (lead & 0xF0) == 0xE0 ? 3 : (lead & 0xF8) == 0xF0 ? 4 : 1;
+		if (length == 1 || position + length > text.size())
+		{
+			position++;
+			return lead;
+		}
+
+		static constexpr uint32_t MinimumCodepoint[] = { 0, 0, 0x80, 0x800, 0x10000 };
+		uint32_t codepoint = lead & (0x7F >> length);
+		for (size_t i = 1; i < length; i++)
+		{
+			uint8_t continuation = (uint8_t)text[position + i];
+			if ((continuation & 0xC0) != 0x80)
+			{
+				position++;
+				return lead;
+			}
+			codepoint = (codepoint << 6) | (continuation & 0x3F);
+		}
+
+		if (codepoint < MinimumCodepoint[length])
+		{
+			position++;
+			return lead;
+		}
+
+		position += length;
+		return codepoint;
+	}
+
+	Font::Font()
+		: m_ID(s_NextFontID.fetch_add(1, std::memory_order_relaxed))
+	{
+		m_GlyphIndices.fill(-1);
+	}
+
+	Font::~Font()
+	{
+		glDeleteTextures(1, &m_Atlas);
+	}
+
+	const FontGlyph* Font::GetGlyph(uint32_t codepoint) const
+	{
+		if (codepoint >= m_GlyphIndices.size() || m_GlyphIndices[codepoint] < 0)
+			return nullptr;
+		return &m_Glyphs[m_GlyphIndices[codepoint]];
+	}
+
+	float Font::GetKerning(uint32_t left, uint32_t right) const
+	{
+		if (m_Kerning.empty())
+			return 0.0f;
+
+		auto it = m_Kerning.find(left << 16 | right);
+		return it != m_Kerning.end() ? it->second : 0.0f;
+	}
+
+	void Font::LayoutText(std::string_view text, TextLayout& outLayout) const
+	{
+		outLayout.Glyphs.clear();
+		outLayout.Min = outLayout.Max = { 0.0f, 0.0f };
+		outLayout.Width = 0.0f;
+		outLayout.LineCount = text.empty() ? 0 : 1;
+
+		const FontGlyph* fallback = GetGlyph('?');
+		const FontGlyph* space = GetGlyph(' ');
+		float tabAdvance = 4.0f * (space ? space->Advance : 0.25f);
+
+		glm::vec2 pen = { 0.0f, 0.0f };
+		uint32_t previous = 0;
+		bool empty = true;
+
+		for (size_t position = 0; position < text.size();)
+		{
+			uint32_t codepoint = DecodeCharacter(text, position);
+			switch (codepoint)
+			{
+				case '\n':
+					outLayout.Width = std::max(outLayout.Width, pen.x);
+					pen = { 0.0f, pen.y - GetLineHeight() };
+					previous = 0;
+					outLayout.LineCount++;
+					continue;
+				case '\r':
+					continue;
+				case '\t':
+					pen.x += tabAdvance;
+					previous = 0;
+					continue;
+			}
+
+			const FontGlyph* glyph = GetGlyph(codepoint);
+			if (!glyph)
+			{
+				glyph = fallback;
+				codepoint = '?';
+				if (!glyph)
+					continue;
+			}
+
+			if (previous)
+				pen.x += GetKerning(previous, codepoint);
+
+			if (glyph->PlaneMax[0] > glyph->PlaneMin[0])
+			{
+				TextLayoutGlyph& quad = outLayout.Glyphs.emplace_back();
+				quad.PlaneMin = pen + glm::vec2(glyph->PlaneMin[0], glyph->PlaneMin[1]);
+				quad.PlaneMax = pen + glm::vec2(glyph->PlaneMax[0], glyph->PlaneMax[1]);
+				quad.UVMin = { glyph->UVMin[0], glyph->UVMin[1] };
+				quad.UVMax = { glyph->UVMax[0], glyph->UVMax[1] };
+
+				outLayout.Min = empty ? quad.PlaneMin : glm::min(outLayout.Min, quad.PlaneMin);
+				outLayout.Max = empty ? quad.PlaneMax : glm::max(outLayout.Max, quad.PlaneMax);
+				empty = false;
+			}
+
+			pen.x += glyph->Advance;
+			previous = codepoint;
+		}
+
+		outLayout.Width = std::max(outLayout.Width, pen.x);
+	}
+
+	Font* Font::FromFile(const std::string& sourcePath)
+	{
+		std::string cookedPath;
+		if (!EnsureCookedFont(sourcePath, cookedPath))
+		{
+			LOG_ERROR("Could not load font '{0}'", sourcePath);
+			return nullptr;
+		}
+
+		return FromCookedFile(cookedPath);
+	}
+
+	Font* Font::FromCookedFile(const std::string& cookedPath)
+	{
+		FileData file;
+		if (!FileSystem::Read(cookedPath, file))
+			return nullptr;
+
+		return FromCookedMemory(file.GetData(), file.GetSize(), cookedPath);
+	}
+
+	Font* Font::FromCookedMemory(const uint8_t* data, size_t size, const std::string& name)
+	{
+		const CookedFontHeader* header = ValidateCookedFont(data, size);
+		if (!header)
+		{
+			LOG_ERROR("'{0}' is not a valid version {1} cooked font", name, CookedFontHeader::CurrentVersion);
+			return nullptr;
+		}
+
+		Font* font = new Font();
+		font->m_AtlasWidth = header->AtlasWidth;
+		font->m_AtlasHeight = header->AtlasHeight;
+		font->m_Ascent = header->Ascent;
+		font->m_Descent = header->Descent;
+		font->m_LineGap = header->LineGap;
+		font->m_DistanceRange = header->DistanceRange;
+
+		const FontGlyph* glyphs = (const FontGlyph*)(data + header->GlyphOffset);
+		for (uint32_t i = 0; i < header->GlyphCount; i++)
+		{
+			if (glyphs[i].Codepoint >= font->m_GlyphIndices.size())
+				continue;
+
+			font->m_GlyphIndices[glyphs[i].Codepoint] = (int16_t)font->m_Glyphs.size();
+			font->m_Glyphs.push_back(glyphs[i]);
+		}
+
+		const FontKerningPair* kerning = (const FontKerningPair*)(data + header->KerningOffset);
+		font->m_Kerning.reserve(header->KerningCount);
+		for (uint32_t i = 0; i < header->KerningCount; i++)
+			font->m_Kerning[(uint32_t)kerning[i].Left << 16 | kerning[i].Right] = kerning[i].Advance;
+
+		// ValidateCookedFont checked the rows suit the default unpack alignment
+		glCreateTextures(GL_TEXTURE_2D, 1, &font->m_Atlas);
+		glTextureStorage2D(font->m_Atlas, 1, GL_R8, header->AtlasWidth, header->AtlasHeight);
+		glTextureSubImage2D(font->m_Atlas, 0, 0, 0, header->AtlasWidth, header->AtlasHeight, GL_RED, GL_UNSIGNED_BYTE, data + header->AtlasOffset);
+
+		glTextureParameteri(font->m_Atlas, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(font->m_Atlas, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTextureParameteri(font->m_Atlas, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(font->m_Atlas, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+		return font;
+	}
+
+}
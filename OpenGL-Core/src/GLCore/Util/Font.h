@@ -0,0 +1,82 @@
+#pragma once
+
+#include "FontCooker.h"
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+namespace GLCore::Utils {
+
+	// One positioned quad of laid out text, em units
+	struct TextLayoutGlyph
+	{
+		glm::vec2 PlaneMin, PlaneMax;
+		glm::vec2 UVMin, UVMax;
+	};
+
+	// Text shaped by Font::LayoutText. The origin is the left end of the
+	// first baseline, y up; following lines go down by the line height.
+	struct TextLayout
+	{
+		std::vector<TextLayoutGlyph> Glyphs;
+		glm::vec2 Min = { 0.0f, 0.0f }, Max = { 0.0f, 0.0f }; // Bounds of the quads
+		float Width = 0.0f; // Longest line, by advance
+		uint32_t LineCount = 0;
+	};
+
+	// Signed distance field font loaded from a cooked .glfont file (see
+	// FontCooker.h). Glyph lookups are a table index, kerning a hash lookup.
+	class Font
+	{
+	public:
+		~Font();
+
+		GLuint GetAtlasRendererID() const { return m_Atlas; }
+		uint32_t GetAtlasWidth() const { return m_AtlasWidth; }
+		uint32_t GetAtlasHeight() const { return m_AtlasHeight; }
+		size_t GetMemorySize() const { return (size_t)m_AtlasWidth * m_AtlasHeight; }
+		// Unique for the lifetime of the process, unlike the address
+		uint64_t GetID() const { return m_ID; }
+
+		// Em units
+		float GetAscent() const { return m_Ascent; }
+		float GetDescent() const { return m_Descent; }
+		float GetLineHeight() const { return m_Ascent - m_Descent + m_LineGap; }
+		float GetDistanceRange() const { return m_DistanceRange; }
+
+		// nullptr if the font has no glyph for codepoint
+		const FontGlyph* GetGlyph(uint32_t codepoint) const;
+		float GetKerning(uint32_t left, uint32_t right) const;
+
+		// Shapes UTF-8 text with kerning, '\n' line breaks and tabs of four
+		// spaces. Bytes that are not valid UTF-8 are read as Latin-1, and
+		// characters the font lacks are drawn as '?'.
+		void LayoutText(std::string_view text, TextLayout& outLayout) const;
+
+		// Loads the cooked file next to sourcePath (see GetCookedFontPath),
+		// cooking it first if it is missing or older than the source
+		static Font* FromFile(const std::string& sourcePath);
+		static Font* FromCookedFile(const std::string& cookedPath);
+		// Contents of a cooked file already in memory; name is for errors
+		static Font* FromCookedMemory(const uint8_t* data, size_t size, const std::string& name);
+	private:
+		Font();
+	private:
+		uint64_t m_ID;
+		GLuint m_Atlas = 0;
+		uint32_t m_AtlasWidth = 0, m_AtlasHeight = 0;
+		float m_Ascent = 0.0f, m_Descent = 0.0f, m_LineGap = 0.0f;
+		float m_DistanceRange = 0.0f;
+
+		std::vector<FontGlyph> m_Glyphs;
+		std::array<int16_t, 256> m_GlyphIndices; // By codepoint, -1 if missing
+		std::unordered_map<uint32_t, float> m_Kerning; // Left << 16 | Right
+	};
+
+}
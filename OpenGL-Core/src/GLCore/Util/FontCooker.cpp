@@ -0,0 +1,245 @@
+#include "glpch.h"
+#include "FontCooker.h"
+
+#include "Cooker.h"
+#include "GLCore/FileSystem/FileSystem.h"
+
+#include <cmath>
+#include <cstring>
+
+// Dear ImGui bundles stb_truetype; imgui_draw.cpp compiles its copy with
+// STBTT_STATIC, so this private one cannot clash with it
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <imstb_truetype.h>
+
+namespace GLCore::Utils {
+
+	static_assert(sizeof(FontGlyph) == 40, "FontGlyph layout is part of the cooked font format");
+	static_assert(sizeof(FontKerningPair) == 8, "FontKerningPair layout is part of the cooked font format");
+	static_assert(sizeof(CookedFontHeader) == 64, "CookedFontHeader layout is part of the cooked font format");
+
+	static const char* s_CookedFontSuffix = ".glfont";
+
+	namespace {
+
+		uint64_t AlignUp(uint64_t value, uint64_t alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+
+		uint32_t NextPowerOfTwo(uint32_t value)
+		{
+			uint32_t result = 1;
+			while (result < value)
+				result <<= 1;
+			return result;
+		}
+
+		struct RenderedGlyph
+		{
+			int Index = 0; // stb_truetype glyph index
+			int Width = 0, Height = 0;
+			uint8_t* Bitmap = nullptr;
+			int X = 0, Y = 0; // In the atlas, bottom-left
+		};
+
+	}
+
+	std::string GetCookedFontPath(const std::string& sourcePath)
+	{
+		return sourcePath + s_CookedFontSuffix;
+	}
+
+	bool CookFont(const std::string& sourcePath, const std::string& cookedPath, const FontCookOptions& options)
+	{
+		FileData source;
+		if (!FileSystem::Read(sourcePath, source))
+			return false;
+
+		// stb_truetype trusts the tables it reads, so only cook fonts you trust
+		stbtt_fontinfo info;
+		int fontOffset = source.GetSize() < 12 ? -1 : stbtt_GetFontOffsetForIndex(source.GetData(), 0);
+		if (fontOffset < 0 || !stbtt_InitFont(&info, source.GetData(), fontOffset))
+		{
+			LOG_ERROR("Could not import font '{0}'", sourcePath);
+			return false;
+		}
+
+		float scale = stbtt_ScaleForPixelHeight(&info, options.PixelHeight);
+		float toEm = 1.0f / options.PixelHeight;
+
+		std::vector<uint32_t> codepoints;
+		for (uint32_t c = 0x20; c <= 0x7E; c++)
+			codepoints.push_back(c);
+		for (uint32_t c = 0xA0; c <= 0xFF; c++)
+			codepoints.push_back(c);
+
+		std::vector<FontGlyph> glyphs;
+		std::vector<RenderedGlyph> rendered;
+		for (uint32_t codepoint : codepoints)
+		{
+			int index = stbtt_FindGlyphIndex(&info, (int)codepoint);
+			if (index == 0 && codepoint != ' ')
+				continue;
+
+			int advance, leftSideBearing;
+			stbtt_GetGlyphHMetrics(&info, index, &advance, &leftSideBearing);
+
+			FontGlyph glyph;
+			glyph.Codepoint = codepoint;
+			glyph.Advance = (float)advance * scale * toEm;
+
+			// Distances of Padding texels map to 0 and 255, the outline to 128
+			RenderedGlyph bitmap;
+			bitmap.Index = index;
+			int xOffset = 0, yOffset = 0;
+			bitmap.Bitmap = stbtt_GetGlyphSDF(&info, scale, index, (int)options.Padding, 128, 128.0f / (float)options.Padding,
+				&bitmap.Width, &bitmap.Height, &xOffset, &yOffset);
+
+			if (bitmap.Bitmap)
+			{
+				// stb_truetype offsets are to the top-left corner, y down
+				glyph.PlaneMin[0] = (float)xOffset * toEm;
+				glyph.PlaneMin[1] = -(float)(yOffset + bitmap.Height) * toEm;
+				glyph.PlaneMax[0] = (float)(xOffset + bitmap.Width) * toEm;
+				glyph.PlaneMax[1] = -(float)yOffset * toEm;
+			}
+
+			glyphs.push_back(glyph);
+			rendered.push_back(bitmap);
+		}
+
+		// Shelf packing, tallest first, one texel apart
+		std::vector<uint32_t> order(glyphs.size());
+		uint64_t area = 0;
+		for (uint32_t i = 0; i < (uint32_t)order.size(); i++)
+		{
+			order[i] = i;
+			area += (uint64_t)(rendered[i].Width + 1) * (rendered[i].Height + 1);
+		}
+		std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return rendered[a].Height > rendered[b].Height; });
+
+		uint32_t atlasWidth = std::max(64u, NextPowerOfTwo((uint32_t)std::ceil(std::sqrt((double)area) * 1.1)));
+		int x = 0, y = 0, shelfHeight = 0;
+		for (uint32_t i : order)
+		{
+			RenderedGlyph& bitmap = rendered[i];
+			if (!bitmap.Bitmap)
+				continue;
+
+			if (x + bitmap.Width > (int)atlasWidth)
+			{
+				x = 0;
+				y += shelfHeight + 1;
+				shelfHeight = 0;
+			}
+			bitmap.X = x;
+			bitmap.Y = y;
+			x += bitmap.Width + 1;
+			shelfHeight = std::max(shelfHeight, bitmap.Height);
+		}
+		uint32_t atlasHeight = std::max(64u, NextPowerOfTwo((uint32_t)(y + shelfHeight)));
+
+		std::vector<uint8_t> atlas((size_t)atlasWidth * atlasHeight, 0);
+		for (size_t i = 0; i < glyphs.size(); i++)
+		{
+			RenderedGlyph& bitmap = rendered[i];
+			if (!bitmap.Bitmap)
+				continue;
+
+			// Bitmap rows are top first, the atlas is bottom first
+			for (int row = 0; row < bitmap.Height; row++)
+			{
+				uint8_t* destination = atlas.data() + (size_t)(bitmap.Y + bitmap.Height - 1 - row) * atlasWidth + bitmap.X;
+				memcpy(destination, bitmap.Bitmap + (size_t)row * bitmap.Width, bitmap.Width);
+			}
+
+			FontGlyph& glyph = glyphs[i];
+			glyph.UVMin[0] = (float)bitmap.X / (float)atlasWidth;
+			glyph.UVMin[1] = (float)bitmap.Y / (float)atlasHeight;
+			glyph.UVMax[0] = (float)(bitmap.X + bitmap.Width) / (float)atlasWidth;
+			glyph.UVMax[1] = (float)(bitmap.Y + bitmap.Height) / (float)atlasHeight;
+
+			stbtt_FreeSDF(bitmap.Bitmap, nullptr);
+		}
+
+		std::vector<FontKerningPair> kerning;
+		for (size_t left = 0; left < glyphs.size(); left++)
+		{
+			for (size_t right = 0; right < glyphs.size(); right++)
+			{
+				int advance = stbtt_GetGlyphKernAdvance(&info, rendered[left].Index, rendered[right].Index);
+				if (advance == 0)
+					continue;
+
+				FontKerningPair pair;
+				pair.Left = (uint16_t)glyphs[left].Codepoint;
+				pair.Right = (uint16_t)glyphs[right].Codepoint;
+				pair.Advance = (float)advance * scale * toEm;
+				kerning.push_back(pair);
+			}
+		}
+
+		int ascent, descent, lineGap;
+		stbtt_GetFontVMetrics(&info, &ascent, &descent, &lineGap);
+
+		CookedFontHeader header;
+		header.GlyphCount = (uint32_t)glyphs.size();
+		header.KerningCount = (uint32_t)kerning.size();
+		header.AtlasWidth = atlasWidth;
+		header.AtlasHeight = atlasHeight;
+		header.Ascent = (float)ascent * scale * toEm;
+		header.Descent = (float)descent * scale * toEm;
+		header.LineGap = (float)lineGap * scale * toEm;
+		header.DistanceRange = (float)options.Padding * toEm;
+		header.GlyphOffset = AlignUp(sizeof(CookedFontHeader), 16);
+		header.KerningOffset = AlignUp(header.GlyphOffset + glyphs.size() * sizeof(FontGlyph), 16);
+		header.AtlasOffset = AlignUp(header.KerningOffset + kerning.size() * sizeof(FontKerningPair), 16);
+
+		std::vector<uint8_t> file(header.AtlasOffset + atlas.size(), 0);
+		memcpy(file.data(), &header, sizeof(header));
+		memcpy(file.data() + header.GlyphOffset, glyphs.data(), glyphs.size() * sizeof(FontGlyph));
+		memcpy(file.data() + header.KerningOffset, kerning.data(), kerning.size() * sizeof(FontKerningPair));
+		memcpy(file.data() + header.AtlasOffset, atlas.data(), atlas.size());
+
+		if (!FileSystem::WriteFileAtomic(cookedPath, file.data(), file.size()))
+			return false;
+
+		LOG_INFO("Cooked font '{0}' ({1} glyphs, {2} kerning pairs, {3}x{4} atlas)", sourcePath, glyphs.size(), kerning.size(), atlasWidth, atlasHeight);
+		return true;
+	}
+
+	bool EnsureCookedFont(const std::string& sourcePath, std::string& outCookedPath)
+	{
+		auto cook = [](const std::string& source, const std::string& cooked) { return CookFont(source, cooked); };
+		return EnsureCooked(sourcePath, s_CookedFontSuffix, cook, outCookedPath);
+	}
+
+	const CookedFontHeader* ValidateCookedFont(const uint8_t* data, size_t size)
+	{
+		if (size < sizeof(CookedFontHeader))
+			return nullptr;
+
+		const CookedFontHeader* header = (const CookedFontHeader*)data;
+		if (header->Magic != CookedFontHeader::MagicValue || header->Version != CookedFontHeader::CurrentVersion)
+			return nullptr;
+		if (header->GlyphOffset % 4 != 0 || header->KerningOffset % 4 != 0)
+			return nullptr;
+		// Rows a multiple of four bytes keep GL's default unpack alignment
+		if (header->AtlasWidth == 0 || header->AtlasWidth % 4 != 0 || header->AtlasHeight == 0)
+			return nullptr;
+		if (header->AtlasWidth > 16384 || header->AtlasHeight > 16384)
+			return nullptr;
+
+		if (!IsRangeInside(header->GlyphOffset, header->GlyphCount, sizeof(FontGlyph), size))
+			return nullptr;
+		if (!IsRangeInside(header->KerningOffset, header->KerningCount, sizeof(FontKerningPair), size))
+			return nullptr;
+		if (!IsRangeInside(header->AtlasOffset, (uint64_t)header->AtlasWidth * header->AtlasHeight, 1, size))
+			return nullptr;
+
+		return header;
+	}
+
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace GLCore::Utils {
+
+	// Metrics and atlas location of one glyph. Plane coordinates are in em
+	// units relative to the pen position on the baseline, y up; a glyph
+	// with no outline (space) has an empty plane and UV rectangle.
+	struct FontGlyph
+	{
+		uint32_t Codepoint = 0;
+		float Advance = 0.0f;
+		float PlaneMin[2] = {}, PlaneMax[2] = {};
+		float UVMin[2] = {}, UVMax[2] = {};
+	};
+
+	struct FontKerningPair
+	{
+		uint16_t Left = 0, Right = 0;
+		float Advance = 0.0f; // em units, added between the two glyphs
+	};
+
+	// Cooked font file (.glfont): this header, GlyphCount FontGlyph records
+	// sorted by codepoint, KerningCount FontKerningPair records, then the
+	// single-channel signed distance field atlas (AtlasWidth x AtlasHeight
+	// bytes, bottom row first). 0.5 in the atlas is the outline. Metrics are
+	// in em units, where 1 is the pixel height the atlas was rendered at.
+	struct CookedFontHeader
+	{
+		static constexpr uint32_t MagicValue = 0x544E4647; // "GFNT"
+		static constexpr uint32_t CurrentVersion = 1;
+
+		uint32_t Magic = MagicValue;
+		uint32_t Version = CurrentVersion;
+		uint32_t GlyphCount = 0;
+		uint32_t KerningCount = 0;
+		uint32_t AtlasWidth = 0;
+		uint32_t AtlasHeight = 0;
+		float Ascent = 0.0f;
+		float Descent = 0.0f; // Negative, below the baseline
+		float LineGap = 0.0f;
+		float DistanceRange = 0.0f; // Em units from the outline to a 0 or 1 texel
+		uint64_t GlyphOffset = 0;
+		uint64_t KerningOffset = 0;
+		uint64_t AtlasOffset = 0;
+	};
+
+	struct FontCookOptions
+	{
+		// Rendered glyph height; larger trades atlas size for sharper corners
+		float PixelHeight = 48.0f;
+		// Texels of distance field around each glyph
+		uint32_t Padding = 6;
+	};
+
+	// "path/font.ttf" -> "path/font.ttf.glfont"
+	std::string GetCookedFontPath(const std::string& sourcePath);
+
+	// Renders printable ASCII and Latin-1 (U+0020-U+007E, U+00A0-U+00FF)
+	// of a TrueType/OpenType font into a distance field atlas, along with
+	// their metrics and kerning pairs, and writes the cooked file
+	bool CookFont(const std::string& sourcePath, const std::string& cookedPath, const FontCookOptions& options = {});
+	// EnsureCooked (Cooker.h) with CookFont
+	bool EnsureCookedFont(const std::string& sourcePath, std::string& outCookedPath);
+
+	// Checks magic, version and that every section lies inside the buffer;
+	// returns the header or nullptr
+	const CookedFontHeader* ValidateCookedFont(const uint8_t* data, size_t size);
+
+}
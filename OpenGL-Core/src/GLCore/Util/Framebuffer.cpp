@@ -0,0 +1,175 @@
+#include "glpch.h"
+#include "Framebuffer.h"
+
+namespace GLCore::Utils {
+
+	Framebuffer::Framebuffer(const FramebufferSpecification& specification)
+		: m_Specification(specification)
+	{
+		Invalidate();
+	}
+
+	Framebuffer::~Framebuffer()
+	{
+		Release();
+	}
+
+	void Framebuffer::Release()
+	{
+		glDeleteFramebuffers(1, &m_RendererID);
+		glDeleteFramebuffers(1, &m_ResolveRendererID);
+		glDeleteTextures(1, &m_ColorAttachment);
+		glDeleteTextures(1, &m_MultisampleColorAttachment);
+		glDeleteRenderbuffers(1, &m_DepthAttachment);
+
+		m_RendererID = m_ResolveRendererID = 0;
+		m_ColorAttachment = m_MultisampleColorAttachment = m_DepthAttachment = 0;
+	}
+
+	void Framebuffer::Invalidate()
+	{
+		Release();
+		UpdateRenderSize();
+
+		// Minimized windows report a zero size
+		if (m_Specification.Width == 0 || m_Specification.Height == 0)
+			return;
+
+		GLint maxSamples = 1;
+		glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+		uint32_t samples = std::min(std::max(m_Specification.Samples, 1u), (uint32_t)maxSamples);
+		bool multisampled = samples > 1;
+
+		glCreateFramebuffers(1, &m_RendererID);
+
+		glCreateTextures(GL_TEXTURE_2D, 1, &m_ColorAttachment);
+		glTextureStorage2D(m_ColorAttachment, 1, m_Specification.ColorFormat, m_Specification.Width, m_Specification.Height);
+		glTextureParameteri(m_ColorAttachment, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(m_ColorAttachment, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTextureParameteri(m_ColorAttachment, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(m_ColorAttachment, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+		if (multisampled)
+		{
+			glCreateTextures(GL_TEXTURE_2D_MULTISAMPLE, 1, &m_MultisampleColorAttachment);
+			glTextureStorage2DMultisample(m_MultisampleColorAttachment, samples, m_Specification.ColorFormat, m_Specification.Width, m_Specification.Height, GL_TRUE);
+			glNamedFramebufferTexture(m_RendererID, GL_COLOR_ATTACHMENT0, m_MultisampleColorAttachment, 0);
+
+			glCreateFramebuffers(1, &m_ResolveRendererID);
+			glNamedFramebufferTexture(m_ResolveRendererID, GL_COLOR_ATTACHMENT0, m_ColorAttachment, 0);
+		}
+		else
+		{
+			glNamedFramebufferTexture(m_RendererID, GL_COLOR_ATTACHMENT0, m_ColorAttachment, 0);
+		}
+
+		if (m_Specification.DepthFormat != GL_NONE)
+		{
+			GLenum attachment = GL_DEPTH_STENCIL_ATTACHMENT;
+			if (m_Specification.DepthFormat == GL_DEPTH_COMPONENT16 || m_Specification.DepthFormat == GL_DEPTH_COMPONENT24 || m_Specification.DepthFormat == GL_DEPTH_COMPONENT32F)
+				attachment = GL_DEPTH_ATTACHMENT;
+
+			// Depth is never sampled, so a renderbuffer is enough
+			glCreateRenderbuffers(1, &m_DepthAttachment);
+			glNamedRenderbufferStorageMultisample(m_DepthAttachment, multisampled ? samples : 0, m_Specification.DepthFormat, m_Specification.Width, m_Specification.Height);
+			glNamedFramebufferRenderbuffer(m_RendererID, attachment, GL_RENDERBUFFER, m_DepthAttachment);
+		}
+
+		GLenum status = glCheckNamedFramebufferStatus(m_RendererID, GL_FRAMEBUFFER);
+		if (status != GL_FRAMEBUFFER_COMPLETE)
+			LOG_ERROR("Framebuffer is incomplete (status 0x{0:x})", status);
+	}
+
+	void Framebuffer::UpdateRenderSize()
+	{
+		float scale = m_Specification.RenderScale;
+		m_RenderWidth = std::max(1u, (uint32_t)(m_Specification.Width * scale + 0.5f));
+		m_RenderHeight = std::max(1u, (uint32_t)(m_Specification.Height * scale + 0.5f));
+	}
+
+	void Framebuffer::Bind()
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+		glViewport(0, 0, m_RenderWidth, m_RenderHeight);
+	}
+
+	void Framebuffer::Unbind()
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	}
+
+	void Framebuffer::Resize(uint32_t width, uint32_t height)
+	{
+		if (width == m_Specification.Width && height == m_Specification.Height)
+			return;
+
+		m_Specification.Width = width;
+		m_Specification.Height = height;
+		Invalidate();
+	}
+
+	void Framebuffer::OnEvent(Event& e)
+	{
+		EventDispatcher dispatcher(e);
+		dispatcher.Dispatch<WindowResizeEvent>(GLCORE_BIND_EVENT_FN(Framebuffer::OnWindowResized));
+	}
+
+	bool Framebuffer::OnWindowResized(WindowResizeEvent& e)
+	{
+		Resize(e.GetWidth(), e.GetHeight());
+		return false;
+	}
+
+	void Framebuffer::SetRenderScale(float scale)
+	{
+		m_Specification.RenderScale = glm::clamp(scale, 0.1f, 1.0f);
+		UpdateRenderSize();
+	}
+
+	glm::vec2 Framebuffer::GetUVScale() const
+	{
+		if (m_Specification.Width == 0 || m_Specification.Height == 0)
+			return { 1.0f, 1.0f };
+
+		return { (float)m_RenderWidth / (float)m_Specification.Width, (float)m_RenderHeight / (float)m_Specification.Height };
+	}
+
+	void Framebuffer::Resolve()
+	{
+		if (!m_ResolveRendererID)
+			return;
+
+		glBlitNamedFramebuffer(m_RendererID, m_ResolveRendererID,
+			0, 0, m_RenderWidth, m_RenderHeight,
+			0, 0, m_RenderWidth, m_RenderHeight,
+			GL_COLOR_BUFFER_BIT, GL_NEAREST);
+	}
+
+	void Framebuffer::BlitTo(GLuint target, uint32_t targetWidth, uint32_t targetHeight, GLenum filter)
+	{
+		if (!m_RendererID)
+			return;
+
+		// A multisampled source can only be blitted 1:1 with GL_NEAREST, so
+		// scaled output goes through the resolved texture first
+		GLuint source = m_RendererID;
+		if (m_ResolveRendererID)
+		{
+			if (m_RenderWidth != targetWidth || m_RenderHeight != targetHeight)
+			{
+				Resolve();
+				source = m_ResolveRendererID;
+			}
+			else
+			{
+				filter = GL_NEAREST;
+			}
+		}
+
+		glBlitNamedFramebuffer(source, target,
+			0, 0, m_RenderWidth, m_RenderHeight,
+			0, 0, targetWidth, targetHeight,
+			GL_COLOR_BUFFER_BIT, filter);
+	}
+
+}
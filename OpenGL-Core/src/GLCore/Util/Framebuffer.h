@@ -0,0 +1,78 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "GLCore/Events/ApplicationEvent.h"
+
+namespace GLCore::Utils {
+
+	struct FramebufferSpecification
+	{
+		uint32_t Width = 0, Height = 0;
+		uint32_t Samples = 1;
+
+		GLenum ColorFormat = GL_RGBA8;
+		GLenum DepthFormat = GL_DEPTH24_STENCIL8; // GL_NONE for no depth attachment
+
+		// Fraction of Width x Height that is rendered and later upscaled
+		float RenderScale = 1.0f;
+	};
+
+	// Offscreen render target with optional MSAA. Attachments are allocated
+	// at the full output size and a lower render scale only shrinks the
+	// viewport, so the scale can change every frame without reallocating.
+	class Framebuffer
+	{
+	public:
+		Framebuffer(const FramebufferSpecification& specification);
+		~Framebuffer();
+
+		Framebuffer(const Framebuffer&) = delete;
+		Framebuffer& operator=(const Framebuffer&) = delete;
+
+		// Binds for drawing and sets the viewport to the render size
+		void Bind();
+		void Unbind();
+
+		void Resize(uint32_t width, uint32_t height);
+		void OnEvent(Event& e);
+
+		void SetRenderScale(float scale);
+		float GetRenderScale() const { return m_Specification.RenderScale; }
+		uint32_t GetRenderWidth() const { return m_RenderWidth; }
+		uint32_t GetRenderHeight() const { return m_RenderHeight; }
+
+		// Resolves the multisampled color into the texture returned by
+		// GetColorAttachment. No-op without MSAA.
+		void Resolve();
+		// Only the render-sized corner of the texture is valid; multiply UVs
+		// by GetUVScale when sampling it
+		GLuint GetColorAttachment() const { return m_ColorAttachment; }
+		glm::vec2 GetUVScale() const;
+
+		// Resolves and scales the rendered image onto target (0 for the
+		// default framebuffer)
+		void BlitTo(GLuint target, uint32_t targetWidth, uint32_t targetHeight, GLenum filter = GL_LINEAR);
+
+		const FramebufferSpecification& GetSpecification() const { return m_Specification; }
+		GLuint GetRendererID() const { return m_RendererID; }
+	private:
+		void Invalidate();
+		void Release();
+		void UpdateRenderSize();
+
+		bool OnWindowResized(WindowResizeEvent& e);
+	private:
+		FramebufferSpecification m_Specification;
+		uint32_t m_RenderWidth = 0, m_RenderHeight = 0;
+
+		GLuint m_RendererID = 0;
+		GLuint m_ColorAttachment = 0, m_DepthAttachment = 0;
+
+		// Multisampled targets only
+		GLuint m_MultisampleColorAttachment = 0;
+		GLuint m_ResolveRendererID = 0;
+	};
+
+}
@@ -0,0 +1,95 @@
+#include "glpch.h"
+#include "Mesh.h"
+#include "MeshCooker.h"
+
+#include "GLCore/FileSystem/FileSystem.h"
+
+namespace GLCore::Utils {
+
+	Mesh::~Mesh()
+	{
+		glDeleteVertexArrays(1, &m_VertexArray);
+		glDeleteBuffers(1, &m_VertexBuffer);
+		glDeleteBuffers(1, &m_IndexBuffer);
+	}
+
+	Mesh* Mesh::FromFile(const std::string& sourcePath)
+	{
+		std::string cookedPath;
+		if (!EnsureCookedMesh(sourcePath, cookedPath))
+		{
+			LOG_ERROR("Could not load mesh '{0}'", sourcePath);
+			return nullptr;
+		}
+
+		return FromCookedFile(cookedPath);
+	}
+
+	Mesh* Mesh::FromCookedFile(const std::string& cookedPath)
+	{
+		FileData file;
+		if (!FileSystem::Read(cookedPath, file))
+			return nullptr;
+
+		return FromCookedMemory(file.GetData(), file.GetSize(), cookedPath);
+	}
+
+	Mesh* Mesh::FromCookedMemory(const uint8_t* data, size_t size, const std::string& name)
+	{
+		if (!ValidateCookedMesh(data, size))
+		{
+			LOG_ERROR("'{0}' is not a valid version {1} cooked mesh", name, CookedMeshHeader::CurrentVersion);
+			return nullptr;
+		}
+
+		return FromValidatedCookedMemory(data);
+	}
+
+	Mesh* Mesh::FromValidatedCookedMemory(const uint8_t* data)
+	{
+		const CookedMeshHeader* header = (const CookedMeshHeader*)data;
+		Mesh* mesh = new Mesh();
+		mesh->m_BoundsMin = { header->BoundsMin[0], header->BoundsMin[1], header->BoundsMin[2] };
+		mesh->m_BoundsMax = { header->BoundsMax[0], header->BoundsMax[1], header->BoundsMax[2] };
+		mesh->Upload(data + header->VertexOffset, header->VertexCount,
+			(const uint32_t*)(data + header->IndexOffset), header->IndexCount);
+		return mesh;
+	}
+
+	Mesh* Mesh::FromMeshData(const MeshData& data)
+	{
+		Mesh* mesh = new Mesh();
+		mesh->m_BoundsMin = data.BoundsMin;
+		mesh->m_BoundsMax = data.BoundsMax;
+		mesh->Upload(data.Vertices.data(), (uint32_t)data.Vertices.size(), data.Indices.data(), (uint32_t)data.Indices.size());
+		return mesh;
+	}
+
+	void Mesh::Upload(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount)
+	{
+		m_VertexCount = vertexCount;
+		m_IndexCount = indexCount;
+
+		glCreateBuffers(1, &m_VertexBuffer);
+		glNamedBufferStorage(m_VertexBuffer, (GLsizeiptr)vertexCount * sizeof(MeshVertex), vertices, 0);
+		glCreateBuffers(1, &m_IndexBuffer);
+		glNamedBufferStorage(m_IndexBuffer, (GLsizeiptr)indexCount * sizeof(uint32_t), indices, 0);
+
+		glCreateVertexArrays(1, &m_VertexArray);
+		glVertexArrayVertexBuffer(m_VertexArray, 0, m_VertexBuffer, 0, sizeof(MeshVertex));
+		glVertexArrayElementBuffer(m_VertexArray, m_IndexBuffer);
+
+		glEnableVertexArrayAttrib(m_VertexArray, 0);
+		glVertexArrayAttribFormat(m_VertexArray, 0, 3, GL_FLOAT, GL_FALSE, offsetof(MeshVertex, Position));
+		glVertexArrayAttribBinding(m_VertexArray, 0, 0);
+
+		glEnableVertexArrayAttrib(m_VertexArray, 1);
+		glVertexArrayAttribFormat(m_VertexArray, 1, 3, GL_FLOAT, GL_FALSE, offsetof(MeshVertex, Normal));
+		glVertexArrayAttribBinding(m_VertexArray, 1, 0);
+
+		glEnableVertexArrayAttrib(m_VertexArray, 2);
+		glVertexArrayAttribFormat(m_VertexArray, 2, 2, GL_FLOAT, GL_FALSE, offsetof(MeshVertex, TexCoord));
+		glVertexArrayAttribBinding(m_VertexArray, 2, 0);
+	}
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+namespace GLCore::Utils {
+
+	// GPU vertex layout, also the layout of vertices in cooked mesh files:
+	// location 0 position, 1 normal, 2 texture coordinate
+	struct MeshVertex
+	{
+		glm::vec3 Position;
+		glm::vec3 Normal;
+		glm::vec2 TexCoord;
+	};
+
+	struct MeshData
+	{
+		std::vector<MeshVertex> Vertices;
+		std::vector<uint32_t> Indices;
+		glm::vec3 BoundsMin = { 0.0f, 0.0f, 0.0f };
+		glm::vec3 BoundsMax = { 0.0f, 0.0f, 0.0f };
+	};
+
+	// Indexed triangle mesh in immutable GL buffers
+	class Mesh
+	{
+	public:
+		~Mesh();
+
+		GLuint GetVertexArray() const { return m_VertexArray; }
+		uint32_t GetVertexCount() const { return m_VertexCount; }
+		uint32_t GetIndexCount() const { return m_IndexCount; }
+		const glm::vec3& GetBoundsMin() const { return m_BoundsMin; }
+		const glm::vec3& GetBoundsMax() const { return m_BoundsMax; }
+		size_t GetMemorySize() const { return (size_t)m_VertexCount * sizeof(MeshVertex) + (size_t)m_IndexCount * sizeof(uint32_t); }
+
+		// Loads the cooked file next to sourcePath (see GetCookedMeshPath),
+		// cooking it first if it is missing or older than the source
+		static Mesh* FromFile(const std::string& sourcePath);
+		// Maps a cooked file (loose or from an uncompressed archive entry) and
+		// uploads it as is; returns nullptr on failure
+		static Mesh* FromCookedFile(const std::string& cookedPath);
+		// Contents of a cooked file already in memory; name is for errors
+		static Mesh* FromCookedMemory(const uint8_t* data, size_t size, const std::string& name);
+		// For data that already passed ValidateCookedMesh, e.g. on a worker,
+		// so the GL thread does not scan the indices a second time
+		static Mesh* FromValidatedCookedMemory(const uint8_t* data);
+		static Mesh* FromMeshData(const MeshData& data);
+	private:
+		Mesh() = default;
+
+		void Upload(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+	private:
+		GLuint m_VertexArray = 0, m_VertexBuffer = 0, m_IndexBuffer = 0;
+		uint32_t m_VertexCount = 0, m_IndexCount = 0;
+		glm::vec3 m_BoundsMin = { 0.0f, 0.0f, 0.0f };
+		glm::vec3 m_BoundsMax = { 0.0f, 0.0f, 0.0f };
+	};
+
+}
@@ -0,0 +1,306 @@
+#include "glpch.h"
+#include "MeshCooker.h"
+
+#include "Cooker.h"
+#include "GLCore/FileSystem/FileSystem.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+namespace GLCore::Utils {
+
+	static_assert(sizeof(MeshVertex) == 32, "MeshVertex layout is part of the cooked mesh format");
+	static_assert(sizeof(CookedMeshHeader) == 64, "CookedMeshHeader layout is part of the cooked mesh format");
+
+	static const char* s_CookedMeshSuffix = ".glmesh";
+
+	namespace {
+
+		struct OBJCorner
+		{
+			int32_t Position, TexCoord, Normal;
+
+			bool operator==(const OBJCorner& other) const
+			{
+				return Position == other.Position && TexCoord == other.TexCoord && Normal == other.Normal;
+			}
+		};
+
+		struct OBJCornerHash
+		{
+			size_t operator()(const OBJCorner& corner) const
+			{
+				uint64_t hash = (uint64_t)(uint32_t)corner.Position * 0x9E3779B97F4A7C15ull;
+				hash ^= (uint64_t)(uint32_t)corner.TexCoord * 0xC2B2AE3D27D4EB4Full + (hash << 6);
+				hash ^= (uint64_t)(uint32_t)corner.Normal * 0x165667B19E3779F9ull + (hash >> 2);
+				return (size_t)hash;
+			}
+		};
+
+		const char* SkipSpaces(const char* p)
+		{
+			while (*p == ' ' || *p == '\t')
+				p++;
+			return p;
+		}
+
+		const char* SkipLine(const char* p)
+		{
+			while (*p && *p != '\n')
+				p++;
+			return *p ? p + 1 : p;
+		}
+
+		// OBJ indices are 1-based, negative ones count back from the end
+		bool ResolveIndex(long index, size_t count, int32_t& outIndex)
+		{
+			long resolved = index < 0 ? (long)count + index : index - 1;
+			if (index == 0 || resolved < 0 || resolved >= (long)count)
+				return false;
+
+			outIndex = (int32_t)resolved;
+			return true;
+		}
+
+		uint64_t AlignUp(uint64_t value, uint64_t alignment)
+		{
+			return (value + alignment - 1) / alignment * alignment;
+		}
+
+	}
+
+	std::string GetCookedMeshPath(const std::string& sourcePath)
+	{
+		return sourcePath + s_CookedMeshSuffix;
+	}
+
+	bool ImportOBJ(const std::string& filepath, MeshData& outData)
+	{
+		std::ifstream in(filepath, std::ios::in | std::ios::binary);
+		if (!in)
+		{
+			LOG_ERROR("Could not open file '{0}'", filepath);
+			return false;
+		}
+
+		std::string source((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		if (!ImportOBJFromSource(source, outData))
+		{
+			LOG_ERROR("Could not import OBJ file '{0}'", filepath);
+			return false;
+		}
+		return true;
+	}
+
+	bool ImportOBJFromSource(const std::string& source, MeshData& outData)
+	{
+		std::vector<glm::vec3> positions, normals;
+		std::vector<glm::vec2> texCoords;
+		std::unordered_map<OBJCorner, uint32_t, OBJCornerHash> vertexLookup;
+		std::vector<uint32_t> polygon;
+		std::vector<uint8_t> generateNormal;
+
+		outData.Vertices.clear();
+		outData.Indices.clear();
+
+		// source is null-terminated, so strtof/strtol can never run past it
+		const char* p = source.c_str();
+		while (*p)
+		{
+			p = SkipSpaces(p);
+			char* next = nullptr;
+
+			if (p[0] == 'v' && (p[1] == ' ' || p[1] == '\t'))
+			{
+				glm::vec3 position;
+				position.x = strtof(p + 1, &next);
+				position.y = strtof(next, &next);
+				position.z = strtof(next, &next);
+				positions.push_back(position);
+			}
+			else if (p[0] == 'v' && p[1] == 't')
+			{
+				glm::vec2 texCoord;
+				texCoord.x = strtof(p + 2, &next);
+				texCoord.y = strtof(next, &next);
+				texCoords.push_back(texCoord);
+			}
+			else if (p[0] == 'v' && p[1] == 'n')
+			{
+				glm::vec3 normal;
+				normal.x = strtof(p + 2, &next);
+				normal.y = strtof(next, &next);
+				normal.z = strtof(next, &next);
+				normals.push_back(normal);
+			}
+			else if (p[0] == 'f' && (p[1] == ' ' || p[1] == '\t'))
+			{
+				polygon.clear();
+				const char* cursor = SkipSpaces(p + 1);
+				// A '#' starts a comment that runs to the end of the line
+				while (*cursor && *cursor != '\n' && *cursor != '\r' && *cursor != '#')
+				{
+					OBJCorner corner = { -1, -1, -1 };
+					if (!ResolveIndex(strtol(cursor, &next, 10), positions.size(), corner.Position))
+						return false;
+					cursor = next;
+
+					if (*cursor == '/')
+					{
+						cursor++;
+						if (*cursor != '/')
+						{
+							if (!ResolveIndex(strtol(cursor, &next, 10), texCoords.size(), corner.TexCoord))
+								return false;
+							cursor = next;
+						}
+
+						if (*cursor == '/')
+						{
+							if (!ResolveIndex(strtol(cursor + 1, &next, 10), normals.size(), corner.Normal))
+								return false;
+							cursor = next;
+						}
+					}
+
+					auto [it, inserted] = vertexLookup.try_emplace(corner, (uint32_t)outData.Vertices.size());
+					if (inserted)
+					{
+						MeshVertex vertex;
+						vertex.Position = positions[corner.Position];
+						vertex.Normal = corner.Normal >= 0 ? normals[corner.Normal] : glm::vec3(0.0f);
+						vertex.TexCoord = corner.TexCoord >= 0 ? texCoords[corner.TexCoord] : glm::vec2(0.0f);
+						outData.Vertices.push_back(vertex);
+						generateNormal.push_back(corner.Normal < 0);
+					}
+					polygon.push_back(it->second);
+
+					cursor = SkipSpaces(cursor);
+				}
+
+				if (polygon.size() < 3)
+					return false;
+
+				for (size_t i = 1; i + 1 < polygon.size(); i++)
+				{
+					outData.Indices.push_back(polygon[0]);
+					outData.Indices.push_back(polygon[i]);
+					outData.Indices.push_back(polygon[i + 1]);
+				}
+			}
+
+			p = SkipLine(p);
+		}
+
+		if (outData.Indices.empty())
+			return false;
+
+		// Area-weighted face normals for vertices the file gave none
+		if (std::find(generateNormal.begin(), generateNormal.end(), 1) != generateNormal.end())
+		{
+			for (size_t i = 0; i < outData.Indices.size(); i += 3)
+			{
+				MeshVertex& a = outData.Vertices[outData.Indices[i]];
+				MeshVertex& b = outData.Vertices[outData.Indices[i + 1]];
+				MeshVertex& c = outData.Vertices[outData.Indices[i + 2]];
+				glm::vec3 faceNormal = glm::cross(b.Position - a.Position, c.Position - a.Position);
+				for (uint32_t corner = 0; corner < 3; corner++)
+				{
+					uint32_t index = outData.Indices[i + corner];
+					if (generateNormal[index])
+						outData.Vertices[index].Normal += faceNormal;
+				}
+			}
+
+			for (size_t i = 0; i < outData.Vertices.size(); i++)
+			{
+				glm::vec3& normal = outData.Vertices[i].Normal;
+				if (generateNormal[i] && glm::dot(normal, normal) > 0.0f)
+					normal = glm::normalize(normal);
+			}
+		}
+
+		outData.BoundsMin = outData.BoundsMax = outData.Vertices[0].Position;
+		for (const MeshVertex& vertex : outData.Vertices)
+		{
+			outData.BoundsMin = glm::min(outData.BoundsMin, vertex.Position);
+			outData.BoundsMax = glm::max(outData.BoundsMax, vertex.Position);
+		}
+
+		return true;
+	}
+
+	bool WriteCookedMesh(const std::string& filepath, const MeshData& data)
+	{
+		CookedMeshHeader header;
+		header.VertexCount = (uint32_t)data.Vertices.size();
+		header.IndexCount = (uint32_t)data.Indices.size();
+		header.VertexOffset = AlignUp(sizeof(CookedMeshHeader), 16);
+		header.IndexOffset = AlignUp(header.VertexOffset + (uint64_t)header.VertexCount * sizeof(MeshVertex), 16);
+		memcpy(header.BoundsMin, &data.BoundsMin, sizeof(header.BoundsMin));
+		memcpy(header.BoundsMax, &data.BoundsMax, sizeof(header.BoundsMax));
+
+		std::vector<uint8_t> file(header.IndexOffset + (uint64_t)header.IndexCount * sizeof(uint32_t), 0);
+		memcpy(file.data(), &header, sizeof(header));
+		memcpy(file.data() + header.VertexOffset, data.Vertices.data(), data.Vertices.size() * sizeof(MeshVertex));
+		memcpy(file.data() + header.IndexOffset, data.Indices.data(), data.Indices.size() * sizeof(uint32_t));
+
+		return FileSystem::WriteFileAtomic(filepath, file.data(), file.size());
+	}
+
+	bool CookMesh(const std::string& sourcePath, const std::string& cookedPath)
+	{
+		std::string extension = std::filesystem::path(sourcePath).extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)tolower(c); });
+		if (extension != ".obj")
+		{
+			LOG_ERROR("Cannot import '{0}': only .obj meshes are supported", sourcePath);
+			return false;
+		}
+
+		MeshData data;
+		if (!ImportOBJ(sourcePath, data))
+			return false;
+
+		LOG_INFO("Cooked mesh '{0}' ({1} vertices, {2} triangles)", sourcePath, data.Vertices.size(), data.Indices.size() / 3);
+		return WriteCookedMesh(cookedPath, data);
+	}
+
+	bool EnsureCookedMesh(const std::string& sourcePath, std::string& outCookedPath)
+	{
+		return EnsureCooked(sourcePath, s_CookedMeshSuffix, CookMesh, outCookedPath);
+	}
+
+	const CookedMeshHeader* ValidateCookedMesh(const uint8_t* data, size_t size)
+	{
+		if (size < sizeof(CookedMeshHeader))
+			return nullptr;
+
+		const CookedMeshHeader* header = (const CookedMeshHeader*)data;
+		if (header->Magic != CookedMeshHeader::MagicValue || header->Version != CookedMeshHeader::CurrentVersion)
+			return nullptr;
+		if (header->VertexStride != sizeof(MeshVertex) || header->IndexCount % 3 != 0)
+			return nullptr;
+		if (header->VertexOffset % 4 != 0 || header->IndexOffset % 4 != 0)
+			return nullptr;
+
+		if (!IsRangeInside(header->VertexOffset, header->VertexCount, sizeof(MeshVertex), size))
+			return nullptr;
+		if (!IsRangeInside(header->IndexOffset, header->IndexCount, sizeof(uint32_t), size))
+			return nullptr;
+
+		// An index past the vertices would make the GPU read outside the buffer
+		const uint32_t* indices = (const uint32_t*)(data + header->IndexOffset);
+		for (uint32_t i = 0; i < header->IndexCount; i++)
+		{
+			if (indices[i] >= header->VertexCount)
+				return nullptr;
+		}
+
+		return header;
+	}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Mesh.h"
+
+namespace GLCore::Utils {
+
+	// Cooked mesh file (.glmesh): this header, then VertexCount MeshVertex
+	// structs, then IndexCount uint32 indices, each section 16-byte aligned.
+	// Data is little-endian and in GPU layout, so loading is a validation
+	// pass and two buffer uploads straight from the mapped file.
+	struct CookedMeshHeader
+	{
+		static constexpr uint32_t MagicValue = 0x48534D47; // "GMSH"
+		static constexpr uint32_t CurrentVersion = 1;
+
+		uint32_t Magic = MagicValue;
+		uint32_t Version = CurrentVersion;
+		uint32_t VertexStride = sizeof(MeshVertex);
+		uint32_t VertexCount = 0;
+		uint32_t IndexCount = 0;
+		uint32_t Reserved = 0;
+		uint64_t VertexOffset = 0;
+		uint64_t IndexOffset = 0;
+		float BoundsMin[3] = {};
+		float BoundsMax[3] = {};
+	};
+
+	// "path/model.obj" -> "path/model.obj.glmesh"
+	std::string GetCookedMeshPath(const std::string& sourcePath);
+
+	// Wavefront OBJ: v, vt, vn and f with any index form; polygons are
+	// triangulated as fans and missing normals are generated. Everything
+	// else is ignored.
+	bool ImportOBJ(const std::string& filepath, MeshData& outData);
+	bool ImportOBJFromSource(const std::string& source, MeshData& outData);
+
+	bool WriteCookedMesh(const std::string& filepath, const MeshData& data);
+
+	// Imports sourcePath by extension and writes the cooked file
+	bool CookMesh(const std::string& sourcePath, const std::string& cookedPath);
+	// EnsureCooked (Cooker.h) with CookMesh
+	bool EnsureCookedMesh(const std::string& sourcePath, std::string& outCookedPath);
+
+	// Checks magic, version, stride, that every section lies inside the
+	// buffer and that every index names a vertex; returns the header or
+	// nullptr. Scans all indices, so run it once per load.
+	const CookedMeshHeader* ValidateCookedMesh(const uint8_t* data, size_t size);
+
+}
@@ -1,42 +1,257 @@
 #include "glpch.h"
 #include "OpenGLDebug.h"
 
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace GLCore::Utils {
 
 	static DebugLogLevel s_DebugLogLevel = DebugLogLevel::HighAssert;
 
+	// The callback runs on whichever thread owns the context, while stats
+	// can be read from any thread
+	static std::mutex s_DebugMutex;
+	static std::unordered_map<uint64_t, GLDebugMessageStats> s_DebugStats;
+	static uint64_t s_DebugFrame = 1;
+	static uint32_t s_RepeatInterval = 60;
+	static spdlog::level::level_enum s_SummaryLevel = spdlog::level::trace;
+	// Keys of disabled messages; source and type 0 match any. Only messages
+	// disabled while counting reach the callback to be checked against it.
+	static std::unordered_set<uint64_t> s_DisabledMessages;
+	static bool s_CountFilteredMessages = false;
+
+	static uint64_t MakeMessageKey(GLenum source, GLenum type, GLuint id)
+	{
+		return ((uint64_t)(source & 0xFFFF) << 48) | ((uint64_t)(type & 0xFFFF) << 32) | id;
+	}
+
+	static const char* GLDebugSourceToString(GLenum source)
+	{
+		switch (source)
+		{
+		case GL_DEBUG_SOURCE_API:             return "API";
+		case GL_DEBUG_SOURCE_WINDOW_SYSTEM:   return "Window System";
+		case GL_DEBUG_SOURCE_SHADER_COMPILER: return "Shader Compiler";
+		case GL_DEBUG_SOURCE_THIRD_PARTY:     return "Third Party";
+		case GL_DEBUG_SOURCE_APPLICATION:     return "Application";
+		case GL_DEBUG_SOURCE_OTHER:           return "Other";
+		}
+		return "Unknown";
+	}
+
+	static const char* GLDebugTypeToString(GLenum type)
+	{
+		switch (type)
+		{
+		case GL_DEBUG_TYPE_ERROR:               return "Error";
+		case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "Deprecated";
+		case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:  return "Undefined Behavior";
+		case GL_DEBUG_TYPE_PORTABILITY:         return "Portability";
+		case GL_DEBUG_TYPE_PERFORMANCE:         return "Performance";
+		case GL_DEBUG_TYPE_MARKER:              return "Marker";
+		case GL_DEBUG_TYPE_PUSH_GROUP:          return "Push Group";
+		case GL_DEBUG_TYPE_POP_GROUP:           return "Pop Group";
+		case GL_DEBUG_TYPE_OTHER:               return "Other";
+		}
+		return "Unknown";
+	}
+
+	static bool ShouldLogSeverity(GLenum severity)
+	{
+		switch (severity)
+		{
+		case GL_DEBUG_SEVERITY_HIGH:         return (int)s_DebugLogLevel > 0;
+		case GL_DEBUG_SEVERITY_MEDIUM:       return (int)s_DebugLogLevel > 2;
+		case GL_DEBUG_SEVERITY_LOW:          return (int)s_DebugLogLevel > 3;
+		case GL_DEBUG_SEVERITY_NOTIFICATION: return (int)s_DebugLogLevel > 4;
+		}
+		return false;
+	}
+
 	void SetGLDebugLogLevel(DebugLogLevel level)
 	{
 		s_DebugLogLevel = level;
 	}
 
+	void SetGLDebugRepeatInterval(uint32_t frames)
+	{
+		std::scoped_lock<std::mutex> lock(s_DebugMutex);
+		s_RepeatInterval = frames;
+	}
+
 	void OpenGLLogMessage(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam)
 	{
-		switch (severity)
+		if (!ShouldLogSeverity(severity))
+			return;
+
 		{
-		case GL_DEBUG_SEVERITY_HIGH:
-			if ((int)s_DebugLogLevel > 0)
+			std::scoped_lock<std::mutex> lock(s_DebugMutex);
+
+			uint64_t key = MakeMessageKey(source, type, id);
+			auto [it, inserted] = s_DebugStats.try_emplace(key);
+			GLDebugMessageStats& stats = it->second;
+			if (inserted)
+			{
+				stats.Source = source;
+				stats.Type = type;
+				stats.Severity = severity;
+				stats.ID = id;
+				stats.FirstFrame = s_DebugFrame;
+				stats.FirstMessage = message;
+			}
+
+			stats.Count++;
+			stats.CountThisFrame++;
+			stats.LastFrame = s_DebugFrame;
+
+			if (!s_DisabledMessages.empty() && (s_DisabledMessages.count(key) || s_DisabledMessages.count(MakeMessageKey(0, 0, id))))
 			{
-				LOG_ERROR("[OpenGL Debug HIGH] {0}", message);
-				if (s_DebugLogLevel == DebugLogLevel::HighAssert)
-					GLCORE_ASSERT(false, "GL_DEBUG_SEVERITY_HIGH");
+				stats.Filtered++;
+				stats.FilteredThisFrame++;
+				return;
 			}
+
+			if (!inserted && s_DebugFrame - stats.LastLoggedFrame < s_RepeatInterval)
+			{
+				stats.SuppressedThisFrame++;
+				return;
+			}
+			stats.LastLoggedFrame = s_DebugFrame;
+		}
+
+		switch (severity)
+		{
+		case GL_DEBUG_SEVERITY_HIGH:
+			LOG_ERROR("[OpenGL Debug HIGH] {0}", message);
+			if (s_DebugLogLevel == DebugLogLevel::HighAssert)
+				GLCORE_ASSERT(false, "GL_DEBUG_SEVERITY_HIGH");
 			break;
 		case GL_DEBUG_SEVERITY_MEDIUM:
-			if ((int)s_DebugLogLevel > 2)
-				LOG_WARN("[OpenGL Debug MEDIUM] {0}", message);
+			LOG_WARN("[OpenGL Debug MEDIUM] {0}", message);
 			break;
 		case GL_DEBUG_SEVERITY_LOW:
-			if ((int)s_DebugLogLevel > 3)
-				LOG_INFO("[OpenGL Debug LOW] {0}", message);
+			LOG_INFO("[OpenGL Debug LOW] {0}", message);
 			break;
 		case GL_DEBUG_SEVERITY_NOTIFICATION:
-			if ((int)s_DebugLogLevel > 4)
-				LOG_TRACE("[OpenGL Debug NOTIFICATION] {0}", message);
+			LOG_TRACE("[OpenGL Debug NOTIFICATION] {0}", message);
 			break;
 		}
 	}
 
+	void EndGLDebugFrame()
+	{
+		std::scoped_lock<std::mutex> lock(s_DebugMutex);
+
+		uint32_t total = 0, suppressed = 0, filtered = 0, unique = 0;
+		for (auto& [key, stats] : s_DebugStats)
+		{
+			if (stats.CountThisFrame == 0)
+				continue;
+
+			total += stats.CountThisFrame;
+			suppressed += stats.SuppressedThisFrame;
+			filtered += stats.FilteredThisFrame;
+			unique++;
+		}
+
+		auto& logger = Log::GetLogger();
+		if ((suppressed > 0 || filtered > 0) && logger && logger->should_log(s_SummaryLevel))
+		{
+			logger->log(s_SummaryLevel, "[OpenGL Debug] frame {0}: {1} messages, {2} unique, {3} repeats suppressed, {4} filtered",
+				s_DebugFrame, total, unique, suppressed, filtered);
+			for (auto& [key, stats] : s_DebugStats)
+			{
+				if (stats.SuppressedThisFrame > 0 || stats.FilteredThisFrame > 0)
+				{
+					logger->log(s_SummaryLevel, "    id {0} ({1}, {2}): {3}x this frame ({4} filtered), {5}x since frame {6}",
+						stats.ID, GLDebugSourceToString(stats.Source), GLDebugTypeToString(stats.Type),
+						stats.CountThisFrame, stats.FilteredThisFrame, stats.Count, stats.FirstFrame);
+				}
+			}
+		}
+
+		for (auto& [key, stats] : s_DebugStats)
+		{
+			stats.CountThisFrame = 0;
+			stats.SuppressedThisFrame = 0;
+			stats.FilteredThisFrame = 0;
+		}
+
+		s_DebugFrame++;
+	}
+
+	void SetGLDebugFrameSummaryLevel(spdlog::level::level_enum level)
+	{
+		std::scoped_lock<std::mutex> lock(s_DebugMutex);
+		s_SummaryLevel = level;
+	}
+
+	// Updates the filter set and returns whether the driver should be told
+	static bool UpdateDisabledMessages(uint64_t key, bool enabled)
+	{
+		std::scoped_lock<std::mutex> lock(s_DebugMutex);
+		if (enabled)
+			s_DisabledMessages.erase(key);
+		else
+			s_DisabledMessages.insert(key);
+
+		// Counted messages must keep reaching the callback
+		return enabled || !s_CountFilteredMessages;
+	}
+
+	void SetGLDebugMessageEnabled(GLenum source, GLenum type, GLuint id, bool enabled)
+	{
+		if (UpdateDisabledMessages(MakeMessageKey(source, type, id), enabled))
+			glDebugMessageControl(source, type, GL_DONT_CARE, 1, &id, enabled ? GL_TRUE : GL_FALSE);
+	}
+
+	void SetGLDebugMessageEnabled(GLuint id, bool enabled)
+	{
+		if (!UpdateDisabledMessages(MakeMessageKey(0, 0, id), enabled))
+			return;
+
+		// glDebugMessageControl only accepts IDs with a concrete source and type
+		const GLenum sources[] = {
+			GL_DEBUG_SOURCE_API, GL_DEBUG_SOURCE_WINDOW_SYSTEM, GL_DEBUG_SOURCE_SHADER_COMPILER,
+			GL_DEBUG_SOURCE_THIRD_PARTY, GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_SOURCE_OTHER
+		};
+		const GLenum types[] = {
+			GL_DEBUG_TYPE_ERROR, GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR, GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR,
+			GL_DEBUG_TYPE_PORTABILITY, GL_DEBUG_TYPE_PERFORMANCE, GL_DEBUG_TYPE_MARKER,
+			GL_DEBUG_TYPE_PUSH_GROUP, GL_DEBUG_TYPE_POP_GROUP, GL_DEBUG_TYPE_OTHER
+		};
+
+		for (GLenum source : sources)
+		{
+			for (GLenum type : types)
+				glDebugMessageControl(source, type, GL_DONT_CARE, 1, &id, enabled ? GL_TRUE : GL_FALSE);
+		}
+	}
+
+	void SetGLDebugCountFilteredMessages(bool enabled)
+	{
+		std::scoped_lock<std::mutex> lock(s_DebugMutex);
+		s_CountFilteredMessages = enabled;
+	}
+
+	std::vector<GLDebugMessageStats> GetGLDebugMessageStats()
+	{
+		std::scoped_lock<std::mutex> lock(s_DebugMutex);
+
+		std::vector<GLDebugMessageStats> result;
+		result.reserve(s_DebugStats.size());
+		for (auto& [key, stats] : s_DebugStats)
+			result.push_back(stats);
+		return result;
+	}
+
+	void ResetGLDebugMessageStats()
+	{
+		std::scoped_lock<std::mutex> lock(s_DebugMutex);
+		s_DebugStats.clear();
+	}
+
 	void EnableGLDebugging()
 	{
 		glDebugMessageCallback(OpenGLLogMessage, nullptr);
@@ -44,4 +259,4 @@ namespace GLCore::Utils {
 		glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
 	}
 
-}
\ No newline at end of file
+}
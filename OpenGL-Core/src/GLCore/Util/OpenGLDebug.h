@@ -4,6 +4,8 @@
 
 #include "GLCore/Core/Log.h"
 
+#include <vector>
+
 namespace GLCore::Utils {
 
 	enum class DebugLogLevel
@@ -11,8 +13,48 @@ namespace GLCore::Utils {
 		None = 0, HighAssert = 1, High = 2, Medium = 3, Low = 4, Notification = 5
 	};
 
+	// Per (source, type, id) counters gathered by the debug callback
+	struct GLDebugMessageStats
+	{
+		GLenum Source = 0, Type = 0, Severity = 0;
+		GLuint ID = 0;
+
+		uint64_t Count = 0, Filtered = 0; // Count includes filtered messages
+		uint64_t FirstFrame = 0, LastFrame = 0;
+		uint32_t CountThisFrame = 0, SuppressedThisFrame = 0, FilteredThisFrame = 0;
+		uint64_t LastLoggedFrame = 0;
+
+		std::string FirstMessage;
+	};
+
 	void EnableGLDebugging();
 	void SetGLDebugLogLevel(DebugLogLevel level);
 	void OpenGLLogMessage(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam);
 
-}
\ No newline at end of file
+	// A repeated message is logged again at most once every `frames` frames;
+	// repeats in between are only counted and reported in the frame summary
+	void SetGLDebugRepeatInterval(uint32_t frames);
+
+	// Call once per frame on the GL context thread. Logs a summary of the
+	// frame's messages if any were suppressed or filtered, and advances the
+	// frame counter.
+	void EndGLDebugFrame();
+	// Level of the frame summary, spdlog::level::off to disable it. The level
+	// is checked at run time, so GLCORE_ACTIVE_LOG_LEVEL does not strip it.
+	void SetGLDebugFrameSummaryLevel(spdlog::level::level_enum level);
+
+	// Runtime message filtering through glDebugMessageControl, so it must be
+	// called on the GL context thread. A disabled message never reaches the
+	// callback. The id-only overload applies to every source and type.
+	void SetGLDebugMessageEnabled(GLenum source, GLenum type, GLuint id, bool enabled);
+	void SetGLDebugMessageEnabled(GLuint id, bool enabled);
+	// Off by default. When on, messages disabled afterwards stay enabled in
+	// the driver and are dropped in the callback instead, so that they are
+	// counted (see GLDebugMessageStats::Filtered). Each one then still costs
+	// a synchronous callback.
+	void SetGLDebugCountFilteredMessages(bool enabled);
+
+	std::vector<GLDebugMessageStats> GetGLDebugMessageStats();
+	void ResetGLDebugMessageStats();
+
+}
@@ -1,29 +1,81 @@
 #include "glpch.h"
 #include "OrthographicCamera.h"
+#include "CameraVersion.h"
 
 #include <glm/gtc/matrix_transform.hpp>
 
 namespace GLCore::Utils {
 
 	OrthographicCamera::OrthographicCamera(float left, float right, float bottom, float top)
-		: m_ProjectionMatrix(glm::ortho(left, right, bottom, top, -1.0f, 1.0f)), m_ViewMatrix(1.0f)
 	{
-		m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+		SetProjection(left, right, bottom, top);
 	}
 
 	void OrthographicCamera::SetProjection(float left, float right, float bottom, float top)
 	{
 		m_ProjectionMatrix = glm::ortho(left, right, bottom, top, -1.0f, 1.0f);
-		m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+
+		// An orthographic projection only scales and offsets each axis
+		glm::mat4 inverse(1.0f);
+		for (int axis = 0; axis < 3; axis++)
+		{
+			inverse[axis][axis] = 1.0f / m_ProjectionMatrix[axis][axis];
+			inverse[3][axis] = -m_ProjectionMatrix[3][axis] / m_ProjectionMatrix[axis][axis];
+		}
+		m_InverseProjectionMatrix = inverse;
+
+		RecalculateMatrices();
+	}
+
+	void OrthographicCamera::SetPosition(const glm::vec3& position)
+	{
+		if (position == m_Position)
+			return;
+
+		m_Position = position;
+		RecalculateMatrices();
+	}
+
+	void OrthographicCamera::SetRotation(float rotation)
+	{
+		if (rotation == m_Rotation)
+			return;
+
+		m_Rotation = rotation;
+		RecalculateMatrices();
 	}
 
-	void OrthographicCamera::RecalculateViewMatrix()
+	void OrthographicCamera::RecalculateMatrices()
 	{
-		glm::mat4 transform = glm::translate(glm::mat4(1.0f), m_Position) *
-			glm::rotate(glm::mat4(1.0f), glm::radians(m_Rotation), glm::vec3(0, 0, 1));
+		m_Version = NextCameraVersion();
+
+		// The camera transform is translate(position) * rotateZ(rotation); its
+		// inverse is the transposed rotation applied to the negated position
+		float radians = glm::radians(m_Rotation);
+		float c = std::cos(radians), s = std::sin(radians);
+		const glm::vec3& p = m_Position;
+
+		m_ViewMatrix = glm::mat4(
+			 c,   -s,   0.0f, 0.0f,
+			 s,    c,   0.0f, 0.0f,
+			0.0f, 0.0f, 1.0f, 0.0f,
+			-(c * p.x + s * p.y), s * p.x - c * p.y, -p.z, 1.0f);
+
+		glm::mat4 transform(
+			 c,    s,   0.0f, 0.0f,
+			-s,    c,   0.0f, 0.0f,
+			0.0f, 0.0f, 1.0f, 0.0f,
+			p.x,  p.y,  p.z,  1.0f);
 
-		m_ViewMatrix = glm::inverse(transform);
 		m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+		m_InverseViewProjectionMatrix = transform * m_InverseProjectionMatrix;
+	}
+
+	glm::vec2 OrthographicCamera::ScreenToWorld(const glm::vec2& screenPosition, float viewportWidth, float viewportHeight) const
+	{
+		glm::vec4 ndc(screenPosition.x / viewportWidth * 2.0f - 1.0f, 1.0f - screenPosition.y / viewportHeight * 2.0f, 0.0f, 1.0f);
+		glm::vec4 world = GetInverseViewProjectionMatrix() * ndc;
+		return { world.x, world.y };
 	}
 
-}
\ No newline at end of file
+}
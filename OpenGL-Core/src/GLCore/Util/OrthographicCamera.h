@@ -4,6 +4,9 @@
 
 namespace GLCore::Utils {
 
+	// Setters rebuild the matrices, and only when they changed something, so
+	// the getters never write and a camera can be read from several threads
+	// while nobody modifies it
 	class OrthographicCamera
 	{
 	public:
@@ -12,23 +15,35 @@ namespace GLCore::Utils {
 		void SetProjection(float left, float right, float bottom, float top);
 
 		const glm::vec3& GetPosition() const { return m_Position; }
-		void SetPosition(const glm::vec3& position) { m_Position = position; RecalculateViewMatrix(); }
+		void SetPosition(const glm::vec3& position);
 
 		float GetRotation() const { return m_Rotation; }
-		void SetRotation(float rotation) { m_Rotation = rotation; RecalculateViewMatrix(); }
+		void SetRotation(float rotation);
 
 		const glm::mat4& GetProjectionMatrix() const { return m_ProjectionMatrix; }
 		const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
 		const glm::mat4& GetViewProjectionMatrix() const { return m_ViewProjectionMatrix; }
+		const glm::mat4& GetInverseViewProjectionMatrix() const { return m_InverseViewProjectionMatrix; }
+
+		// Changes whenever the view-projection changes and is unique across
+		// cameras, so uploads of unchanged camera data can be skipped
+		uint64_t GetVersion() const { return m_Version; }
+
+		// Window coordinates (origin top-left, y down) to world space x/y
+		glm::vec2 ScreenToWorld(const glm::vec2& screenPosition, float viewportWidth, float viewportHeight) const;
 	private:
-		void RecalculateViewMatrix();
+		void RecalculateMatrices();
 	private:
 		glm::mat4 m_ProjectionMatrix;
+		glm::mat4 m_InverseProjectionMatrix;
 		glm::mat4 m_ViewMatrix;
 		glm::mat4 m_ViewProjectionMatrix;
+		glm::mat4 m_InverseViewProjectionMatrix;
 
 		glm::vec3 m_Position = { 0.0f, 0.0f, 0.0f };
 		float m_Rotation = 0.0f;
+
+		uint64_t m_Version = 0;
 	};
 
 }
@@ -13,29 +13,30 @@ namespace GLCore::Utils {
 
 	void OrthographicCameraController::OnUpdate(Timestep ts)
 	{
+		m_CameraTranslationSpeed = m_ZoomLevel;
+
+		// Right and up in world space, following the camera rotation
+		glm::vec2 move(0.0f);
 		if (Input::IsKeyPressed(HZ_KEY_A))
-		{
-			m_CameraPosition.x -= cos(glm::radians(m_CameraRotation)) * m_CameraTranslationSpeed * ts;
-			m_CameraPosition.y -= sin(glm::radians(m_CameraRotation)) * m_CameraTranslationSpeed * ts;
-		}
+			move.x = -1.0f;
 		else if (Input::IsKeyPressed(HZ_KEY_D))
-		{
-			m_CameraPosition.x += cos(glm::radians(m_CameraRotation)) * m_CameraTranslationSpeed * ts;
-			m_CameraPosition.y += sin(glm::radians(m_CameraRotation)) * m_CameraTranslationSpeed * ts;
-		}
+			move.x = 1.0f;
 
 		if (Input::IsKeyPressed(HZ_KEY_W))
-		{
-			m_CameraPosition.x += -sin(glm::radians(m_CameraRotation)) * m_CameraTranslationSpeed * ts;
-			m_CameraPosition.y += cos(glm::radians(m_CameraRotation)) * m_CameraTranslationSpeed * ts;
-		}
+			move.y = 1.0f;
 		else if (Input::IsKeyPressed(HZ_KEY_S))
+			move.y = -1.0f;
+
+		if (move.x != 0.0f || move.y != 0.0f)
 		{
-			m_CameraPosition.x -= -sin(glm::radians(m_CameraRotation)) * m_CameraTranslationSpeed * ts;
-			m_CameraPosition.y -= cos(glm::radians(m_CameraRotation)) * m_CameraTranslationSpeed * ts;
+			float c = cos(glm::radians(m_CameraRotation)), s = sin(glm::radians(m_CameraRotation));
+			float distance = m_CameraTranslationSpeed * ts;
+			m_CameraPosition.x += (move.x * c - move.y * s) * distance;
+			m_CameraPosition.y += (move.x * s + move.y * c) * distance;
+			m_Camera.SetPosition(m_CameraPosition);
 		}
 
-		if (m_Rotation)
+		if (m_Rotation && (Input::IsKeyPressed(HZ_KEY_Q) || Input::IsKeyPressed(HZ_KEY_E)))
 		{
 			if (Input::IsKeyPressed(HZ_KEY_Q))
 				m_CameraRotation += m_CameraRotationSpeed * ts;
@@ -49,10 +50,6 @@ namespace GLCore::Utils {
 
 			m_Camera.SetRotation(m_CameraRotation);
 		}
-
-		m_Camera.SetPosition(m_CameraPosition);
-
-		m_CameraTranslationSpeed = m_ZoomLevel;
 	}
 
 	void OrthographicCameraController::OnEvent(Event& e)
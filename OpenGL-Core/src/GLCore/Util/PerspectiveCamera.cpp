@@ -0,0 +1,101 @@
+#include "glpch.h"
+#include "PerspectiveCamera.h"
+#include "CameraVersion.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace GLCore::Utils {
+
+	static constexpr float s_MaxPitch = 89.0f;
+
+	PerspectiveCamera::PerspectiveCamera(float verticalFov, float aspectRatio, float nearClip, float farClip)
+	{
+		SetProjection(verticalFov, aspectRatio, nearClip, farClip);
+	}
+
+	void PerspectiveCamera::SetProjection(float verticalFov, float aspectRatio, float nearClip, float farClip)
+	{
+		m_VerticalFov = verticalFov;
+		m_AspectRatio = aspectRatio;
+		m_NearClip = nearClip;
+		m_FarClip = farClip;
+
+		m_ProjectionMatrix = glm::perspective(glm::radians(verticalFov), aspectRatio, nearClip, farClip);
+
+		// Only five entries of a perspective projection are non-zero, so the
+		// inverse is written out directly
+		const glm::mat4& p = m_ProjectionMatrix;
+		glm::mat4 inverse(0.0f);
+		inverse[0][0] = 1.0f / p[0][0];
+		inverse[1][1] = 1.0f / p[1][1];
+		inverse[2][3] = 1.0f / p[3][2];
+		inverse[3][2] = 1.0f / p[2][3];
+		inverse[3][3] = -p[2][2] / (p[3][2] * p[2][3]);
+		m_InverseProjectionMatrix = inverse;
+
+		RecalculateMatrices();
+	}
+
+	void PerspectiveCamera::SetPosition(const glm::vec3& position)
+	{
+		if (position == m_Position)
+			return;
+
+		m_Position = position;
+		RecalculateMatrices();
+	}
+
+	void PerspectiveCamera::SetOrientation(float yaw, float pitch)
+	{
+		pitch = glm::clamp(pitch, -s_MaxPitch, s_MaxPitch);
+		if (yaw == m_Yaw && pitch == m_Pitch)
+			return;
+
+		m_Yaw = yaw;
+		m_Pitch = pitch;
+		RecalculateMatrices();
+	}
+
+	void PerspectiveCamera::RecalculateMatrices()
+	{
+		m_Version = NextCameraVersion();
+
+		float yaw = glm::radians(m_Yaw), pitch = glm::radians(m_Pitch);
+		float cy = std::cos(yaw), sy = std::sin(yaw);
+		float cp = std::cos(pitch), sp = std::sin(pitch);
+
+		m_Forward = { -sy * cp, sp, -cy * cp };
+		m_Right = { cy, 0.0f, -sy };
+		m_Up = glm::cross(m_Right, m_Forward);
+
+		// The camera transform has columns right, up, -forward and position;
+		// the view matrix is its transpose with the position rotated in
+		const glm::vec3& r = m_Right;
+		const glm::vec3& u = m_Up;
+		const glm::vec3& f = m_Forward;
+		const glm::vec3& p = m_Position;
+
+		m_ViewMatrix = glm::mat4(
+			r.x, u.x, -f.x, 0.0f,
+			r.y, u.y, -f.y, 0.0f,
+			r.z, u.z, -f.z, 0.0f,
+			-glm::dot(r, p), -glm::dot(u, p), glm::dot(f, p), 1.0f);
+
+		glm::mat4 transform(
+			 r.x,  r.y,  r.z, 0.0f,
+			 u.x,  u.y,  u.z, 0.0f,
+			-f.x, -f.y, -f.z, 0.0f,
+			 p.x,  p.y,  p.z, 1.0f);
+
+		m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+		m_InverseViewProjectionMatrix = transform * m_InverseProjectionMatrix;
+	}
+
+	glm::vec3 PerspectiveCamera::ScreenToWorldDirection(const glm::vec2& screenPosition, float viewportWidth, float viewportHeight) const
+	{
+		glm::vec4 ndc(screenPosition.x / viewportWidth * 2.0f - 1.0f, 1.0f - screenPosition.y / viewportHeight * 2.0f, 1.0f, 1.0f);
+		glm::vec4 world = GetInverseViewProjectionMatrix() * ndc;
+		return glm::normalize(glm::vec3(world.x, world.y, world.z) / world.w - m_Position);
+	}
+
+}
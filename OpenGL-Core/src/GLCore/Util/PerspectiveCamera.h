@@ -0,0 +1,66 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace GLCore::Utils {
+
+	// Right-handed, looking down -Z at zero yaw and pitch. Like
+	// OrthographicCamera, setters rebuild the matrices after a change.
+	class PerspectiveCamera
+	{
+	public:
+		// verticalFov in degrees
+		PerspectiveCamera(float verticalFov, float aspectRatio, float nearClip = 0.1f, float farClip = 1000.0f);
+
+		void SetProjection(float verticalFov, float aspectRatio, float nearClip, float farClip);
+		void SetAspectRatio(float aspectRatio) { SetProjection(m_VerticalFov, aspectRatio, m_NearClip, m_FarClip); }
+		void SetVerticalFov(float verticalFov) { SetProjection(verticalFov, m_AspectRatio, m_NearClip, m_FarClip); }
+
+		float GetVerticalFov() const { return m_VerticalFov; }
+		float GetAspectRatio() const { return m_AspectRatio; }
+		float GetNearClip() const { return m_NearClip; }
+		float GetFarClip() const { return m_FarClip; }
+
+		const glm::vec3& GetPosition() const { return m_Position; }
+		void SetPosition(const glm::vec3& position);
+
+		// Degrees; yaw turns anti-clockwise around +Y, pitch is clamped to
+		// just short of straight up or down
+		float GetYaw() const { return m_Yaw; }
+		float GetPitch() const { return m_Pitch; }
+		void SetOrientation(float yaw, float pitch);
+
+		const glm::vec3& GetForwardDirection() const { return m_Forward; }
+		const glm::vec3& GetRightDirection() const { return m_Right; }
+		const glm::vec3& GetUpDirection() const { return m_Up; }
+
+		const glm::mat4& GetProjectionMatrix() const { return m_ProjectionMatrix; }
+		const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
+		const glm::mat4& GetViewProjectionMatrix() const { return m_ViewProjectionMatrix; }
+		const glm::mat4& GetInverseViewProjectionMatrix() const { return m_InverseViewProjectionMatrix; }
+
+		// See OrthographicCamera::GetVersion; both share one counter
+		uint64_t GetVersion() const { return m_Version; }
+
+		// Normalized world-space direction of the ray from the camera through
+		// a window position (origin top-left, y down)
+		glm::vec3 ScreenToWorldDirection(const glm::vec2& screenPosition, float viewportWidth, float viewportHeight) const;
+	private:
+		void RecalculateMatrices();
+	private:
+		float m_VerticalFov, m_AspectRatio, m_NearClip, m_FarClip;
+
+		glm::mat4 m_ProjectionMatrix;
+		glm::mat4 m_InverseProjectionMatrix;
+		glm::mat4 m_ViewMatrix;
+		glm::mat4 m_ViewProjectionMatrix;
+		glm::mat4 m_InverseViewProjectionMatrix;
+		glm::vec3 m_Forward, m_Right, m_Up;
+
+		glm::vec3 m_Position = { 0.0f, 0.0f, 0.0f };
+		float m_Yaw = 0.0f, m_Pitch = 0.0f;
+
+		uint64_t m_Version = 0;
+	};
+
+}
@@ -0,0 +1,78 @@
+#include "glpch.h"
+#include "PerspectiveCameraController.h"
+
+#include "GLCore/Core/Input.h"
+#include "GLCore/Core/KeyCodes.h"
+#include "GLCore/Core/MouseButtonCodes.h"
+
+namespace GLCore::Utils {
+
+	PerspectiveCameraController::PerspectiveCameraController(float aspectRatio, float verticalFov)
+		: m_Camera(verticalFov, aspectRatio), m_LastMousePosition(Input::GetMouseX(), Input::GetMouseY())
+	{
+		m_Camera.SetPosition(m_CameraPosition);
+	}
+
+	void PerspectiveCameraController::OnUpdate(Timestep ts)
+	{
+		glm::vec2 mousePosition = { Input::GetMouseX(), Input::GetMouseY() };
+		glm::vec2 mouseDelta = mousePosition - m_LastMousePosition;
+		m_LastMousePosition = mousePosition;
+
+		if (Input::IsMouseButtonPressed(HZ_MOUSE_BUTTON_RIGHT) && (mouseDelta.x != 0.0f || mouseDelta.y != 0.0f))
+		{
+			m_Yaw -= mouseDelta.x * m_LookSensitivity;
+			m_Pitch = glm::clamp(m_Pitch - mouseDelta.y * m_LookSensitivity, -89.0f, 89.0f);
+			m_Camera.SetOrientation(m_Yaw, m_Pitch);
+		}
+
+		// Right, up and forward in camera space
+		glm::vec3 move(0.0f);
+		if (Input::IsKeyPressed(HZ_KEY_A))
+			move.x = -1.0f;
+		else if (Input::IsKeyPressed(HZ_KEY_D))
+			move.x = 1.0f;
+
+		if (Input::IsKeyPressed(HZ_KEY_SPACE))
+			move.y = 1.0f;
+		else if (Input::IsKeyPressed(HZ_KEY_LEFT_CONTROL))
+			move.y = -1.0f;
+
+		if (Input::IsKeyPressed(HZ_KEY_W))
+			move.z = 1.0f;
+		else if (Input::IsKeyPressed(HZ_KEY_S))
+			move.z = -1.0f;
+
+		if (move.x != 0.0f || move.y != 0.0f || move.z != 0.0f)
+		{
+			float distance = m_MovementSpeed * ts * (Input::IsKeyPressed(HZ_KEY_LEFT_SHIFT) ? 4.0f : 1.0f);
+			m_CameraPosition += (move.x * m_Camera.GetRightDirection() + move.z * m_Camera.GetForwardDirection()) * distance;
+			m_CameraPosition.y += move.y * distance;
+			m_Camera.SetPosition(m_CameraPosition);
+		}
+	}
+
+	void PerspectiveCameraController::OnEvent(Event& e)
+	{
+		EventDispatcher dispatcher(e);
+		dispatcher.Dispatch<MouseScrolledEvent>(GLCORE_BIND_EVENT_FN(PerspectiveCameraController::OnMouseScrolled));
+		dispatcher.Dispatch<WindowResizeEvent>(GLCORE_BIND_EVENT_FN(PerspectiveCameraController::OnWindowResized));
+	}
+
+	bool PerspectiveCameraController::OnMouseScrolled(MouseScrolledEvent& e)
+	{
+		float verticalFov = glm::clamp(m_Camera.GetVerticalFov() - e.GetYOffset() * 2.0f, 10.0f, 90.0f);
+		m_Camera.SetVerticalFov(verticalFov);
+		return false;
+	}
+
+	bool PerspectiveCameraController::OnWindowResized(WindowResizeEvent& e)
+	{
+		if (e.GetWidth() == 0 || e.GetHeight() == 0)
+			return false;
+
+		m_Camera.SetAspectRatio((float)e.GetWidth() / (float)e.GetHeight());
+		return false;
+	}
+
+}
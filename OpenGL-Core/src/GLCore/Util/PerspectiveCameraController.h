@@ -0,0 +1,44 @@
+#pragma once
+
+#include "PerspectiveCamera.h"
+#include "GLCore/Core/Timestep.h"
+
+#include "GLCore/Events/ApplicationEvent.h"
+#include "GLCore/Events/MouseEvent.h"
+
+namespace GLCore::Utils {
+
+	// Fly camera: WASD moves, Space/Left Control rise and sink, Left Shift
+	// speeds up, dragging with the right mouse button looks around and the
+	// scroll wheel zooms by narrowing the field of view
+	class PerspectiveCameraController
+	{
+	public:
+		PerspectiveCameraController(float aspectRatio, float verticalFov = 45.0f);
+
+		void OnUpdate(Timestep ts);
+		void OnEvent(Event& e);
+
+		PerspectiveCamera& GetCamera() { return m_Camera; }
+		const PerspectiveCamera& GetCamera() const { return m_Camera; }
+
+		float GetMovementSpeed() const { return m_MovementSpeed; }
+		void SetMovementSpeed(float speed) { m_MovementSpeed = speed; }
+
+		// Degrees per pixel of mouse movement
+		float GetLookSensitivity() const { return m_LookSensitivity; }
+		void SetLookSensitivity(float sensitivity) { m_LookSensitivity = sensitivity; }
+	private:
+		bool OnMouseScrolled(MouseScrolledEvent& e);
+		bool OnWindowResized(WindowResizeEvent& e);
+	private:
+		PerspectiveCamera m_Camera;
+
+		glm::vec3 m_CameraPosition = { 0.0f, 0.0f, 5.0f };
+		float m_Yaw = 0.0f, m_Pitch = 0.0f;
+		float m_MovementSpeed = 5.0f, m_LookSensitivity = 0.15f;
+
+		glm::vec2 m_LastMousePosition = { 0.0f, 0.0f };
+	};
+
+}
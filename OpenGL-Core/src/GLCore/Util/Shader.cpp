@@ -1,27 +1,15 @@
 #include "glpch.h"
 #include "Shader.h"
 
-#include <fstream>
+#include "GLCore/FileSystem/FileSystem.h"
+#include "GLCore/Renderer/FrameUniformBuffer.h"
 
 namespace GLCore::Utils {
 
 	static std::string ReadFileAsString(const std::string& filepath)
 	{
 		std::string result;
-		std::ifstream in(filepath, std::ios::in | std::ios::binary);
-		if (in)
-		{
-			in.seekg(0, std::ios::end);
-			result.resize((size_t)in.tellg());
-			in.seekg(0, std::ios::beg);
-			in.read(&result[0], result.size());
-			in.close();
-		}
-		else
-		{
-			LOG_ERROR("Could not open file '{0}'", filepath);
-		}
-
+		FileSystem::ReadText(filepath, result);
 		return result;
 	}
 
@@ -64,12 +52,21 @@ namespace GLCore::Utils {
 		shader->LoadFromGLSLTextFiles(vertexShaderPath, fragmentShaderPath);
 		return shader;
 	}
+
+	Shader* Shader::FromGLSLSource(const std::string& vertexSource, const std::string& fragmentSource)
+	{
+		Shader* shader = new Shader();
+		shader->LoadFromGLSLSource(vertexSource, fragmentSource);
+		return shader;
+	}
 	
 	void Shader::LoadFromGLSLTextFiles(const std::string& vertexShaderPath, const std::string& fragmentShaderPath)
 	{
-		std::string vertexSource = ReadFileAsString(vertexShaderPath);
-		std::string fragmentSource = ReadFileAsString(fragmentShaderPath);
+		LoadFromGLSLSource(ReadFileAsString(vertexShaderPath), ReadFileAsString(fragmentShaderPath));
+	}
 
+	void Shader::LoadFromGLSLSource(const std::string& vertexSource, const std::string& fragmentSource)
+	{
 		GLuint program = glCreateProgram();
 		int glShaderIDIndex = 0;
 			
@@ -105,6 +102,29 @@ namespace GLCore::Utils {
 		glDeleteShader(fragmentShader);
 
 		m_RendererID = program;
+
+		if (isLinked)
+		{
+			BindFrameDataBlock();
+
+			m_DrawUniforms.ViewProjection = glGetUniformLocation(program, "u_ViewProjection");
+			m_DrawUniforms.Transform = glGetUniformLocation(program, "u_Transform");
+			m_DrawUniforms.Color = glGetUniformLocation(program, "u_Color");
+		}
+	}
+
+	void Shader::BindFrameDataBlock()
+	{
+		GLuint blockIndex = glGetUniformBlockIndex(m_RendererID, FrameUniformBuffer::BlockName);
+		if (blockIndex == GL_INVALID_INDEX)
+			return;
+
+		GLint blockSize = 0;
+		glGetActiveUniformBlockiv(m_RendererID, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &blockSize);
+		if ((size_t)blockSize > sizeof(FrameData))
+			LOG_WARN("Shader declares a {0} block of {1} bytes, larger than FrameData ({2} bytes)", FrameUniformBuffer::BlockName, blockSize, sizeof(FrameData));
+
+		glUniformBlockBinding(m_RendererID, blockIndex, FrameUniformBuffer::BindingPoint);
 	}
 
 }
\ No newline at end of file
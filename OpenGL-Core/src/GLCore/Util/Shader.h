@@ -1,26 +1,42 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include <glad/glad.h>
 
 namespace GLCore::Utils {
 
+	// Locations of the uniforms RenderCommandQueue sets, -1 where the shader
+	// does not declare them. The camera version last uploaded lives here too:
+	// uniforms are program state, shared by every queue drawing with it.
+	struct ShaderDrawUniforms
+	{
+		GLint ViewProjection = -1, Transform = -1, Color = -1;
+		uint64_t ViewProjectionVersion = 0;
+	};
+
 	class Shader
 	{
 	public:
 		~Shader();
 
 		GLuint GetRendererID() { return m_RendererID; }
+		ShaderDrawUniforms& GetDrawUniforms() { return m_DrawUniforms; }
 
+		// Paths are resolved through FileSystem, so they may live in an archive
 		static Shader* FromGLSLTextFiles(const std::string& vertexShaderPath, const std::string& fragmentShaderPath);
+		static Shader* FromGLSLSource(const std::string& vertexSource, const std::string& fragmentSource);
 	private:
 		Shader() = default;
 
 		void LoadFromGLSLTextFiles(const std::string& vertexShaderPath, const std::string& fragmentShaderPath);
+		void LoadFromGLSLSource(const std::string& vertexSource, const std::string& fragmentSource);
 		GLuint CompileShader(GLenum type, const std::string& source);
+		void BindFrameDataBlock();
 	private:
 		GLuint m_RendererID;
+		ShaderDrawUniforms m_DrawUniforms;
 	};
 
 }
\ No newline at end of file
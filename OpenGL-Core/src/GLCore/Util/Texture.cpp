@@ -0,0 +1,97 @@
+#include "glpch.h"
+#include "Texture.h"
+
+#include "GLCore/FileSystem/FileSystem.h"
+
+#include "stb_image.h"
+
+#include <cstring>
+
+namespace GLCore::Utils {
+
+	Texture2D::~Texture2D()
+	{
+		glDeleteTextures(1, &m_RendererID);
+	}
+
+	size_t Texture2D::GetMemorySize() const
+	{
+		// A full mip chain adds a third
+		return (size_t)m_Width * m_Height * 4 * 4 / 3;
+	}
+
+	Texture2D* Texture2D::FromFile(const std::string& filepath)
+	{
+		uint32_t width, height;
+		uint8_t* pixels = DecodeImageFile(filepath, width, height);
+		if (!pixels)
+			return nullptr;
+
+		Texture2D* texture = FromPixels(width, height, pixels);
+		FreeImagePixels(pixels);
+		return texture;
+	}
+
+	Texture2D* Texture2D::FromPixels(uint32_t width, uint32_t height, const void* pixels)
+	{
+		uint32_t levels = 1;
+		while ((width | height) >> levels)
+			levels++;
+
+		Texture2D* texture = new Texture2D();
+		texture->m_Width = width;
+		texture->m_Height = height;
+
+		GLuint id;
+		glCreateTextures(GL_TEXTURE_2D, 1, &id);
+		glTextureStorage2D(id, levels, GL_RGBA8, width, height);
+		glTextureSubImage2D(id, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+		glGenerateTextureMipmap(id);
+
+		glTextureParameteri(id, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTextureParameteri(id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTextureParameteri(id, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(id, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+		texture->m_RendererID = id;
+		return texture;
+	}
+
+	uint8_t* DecodeImageFile(const std::string& filepath, uint32_t& outWidth, uint32_t& outHeight)
+	{
+		// stbi_set_flip_vertically_on_load is global state, so flip here
+		// instead to stay safe on worker threads
+		FileData file;
+		if (!FileSystem::Read(filepath, file))
+			return nullptr;
+
+		int width, height, channels;
+		stbi_uc* pixels = stbi_load_from_memory(file.GetData(), (int)file.GetSize(), &width, &height, &channels, 4);
+		if (!pixels)
+		{
+			LOG_ERROR("Could not load image '{0}': {1}", filepath, stbi_failure_reason());
+			return nullptr;
+		}
+
+		size_t rowSize = (size_t)width * 4;
+		std::vector<uint8_t> row(rowSize);
+		for (int y = 0; y < height / 2; y++)
+		{
+			uint8_t* top = pixels + y * rowSize;
+			uint8_t* bottom = pixels + (height - 1 - y) * rowSize;
+			memcpy(row.data(), top, rowSize);
+			memcpy(top, bottom, rowSize);
+			memcpy(bottom, row.data(), rowSize);
+		}
+
+		outWidth = (uint32_t)width;
+		outHeight = (uint32_t)height;
+		return pixels;
+	}
+
+	void FreeImagePixels(uint8_t* pixels)
+	{
+		stbi_image_free(pixels);
+	}
+
+}
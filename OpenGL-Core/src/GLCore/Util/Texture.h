@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+
+#include <glad/glad.h>
+
+namespace GLCore::Utils {
+
+	// Immutable RGBA8 texture with a full mip chain
+	class Texture2D
+	{
+	public:
+		~Texture2D();
+
+		GLuint GetRendererID() const { return m_RendererID; }
+		uint32_t GetWidth() const { return m_Width; }
+		uint32_t GetHeight() const { return m_Height; }
+		// Including mips
+		size_t GetMemorySize() const;
+
+		// Decodes with stb_image and uploads; returns nullptr on failure
+		static Texture2D* FromFile(const std::string& filepath);
+		// pixels are tightly packed RGBA8 rows, bottom row first
+		static Texture2D* FromPixels(uint32_t width, uint32_t height, const void* pixels);
+	private:
+		Texture2D() = default;
+	private:
+		GLuint m_RendererID = 0;
+		uint32_t m_Width = 0, m_Height = 0;
+	};
+
+	// Decodes an image file (resolved through FileSystem) to RGBA8, flipped
+	// so the bottom row comes first as GL expects. Thread-safe; free the
+	// result with FreeImagePixels.
+	uint8_t* DecodeImageFile(const std::string& filepath, uint32_t& outWidth, uint32_t& outHeight);
+	void FreeImagePixels(uint8_t* pixels);
+
+}
@@ -0,0 +1,325 @@
+#include "glpch.h"
+#include "TransformKernels.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define GLCORE_SIMD_X86
+	#include <immintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+		#define GLCORE_TARGET_AVX2
+	#else
+		#include <cpuid.h>
+		#define GLCORE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+	#endif
+#endif
+
+namespace GLCore::Utils {
+
+	static SIMDLevel DetectSIMDLevel()
+	{
+#ifdef GLCORE_SIMD_X86
+		uint32_t regs[4] = {};
+		auto cpuid = [&regs](uint32_t leaf, uint32_t subleaf)
+		{
+#ifdef _MSC_VER
+			__cpuidex((int*)regs, (int)leaf, (int)subleaf);
+#else
+			__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+		};
+
+		cpuid(0, 0);
+		uint32_t maxLeaf = regs[0];
+
+		cpuid(1, 0);
+		bool sse2 = regs[3] & (1 << 26);
+		bool fma = regs[2] & (1 << 12);
+		bool osxsave = regs[2] & (1 << 27);
+		bool avx = regs[2] & (1 << 28);
+
+		bool avx2 = false;
+		if (maxLeaf >= 7 && osxsave && avx && fma)
+		{
+			// The OS must also save the YMM registers on context switch
+#ifdef _MSC_VER
+			uint64_t xcr0 = _xgetbv(0);
+#else
+			uint32_t eax, edx;
+			__asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			uint64_t xcr0 = ((uint64_t)edx << 32) | eax;
+#endif
+			cpuid(7, 0);
+			avx2 = (xcr0 & 0x6) == 0x6 && (regs[1] & (1 << 5));
+		}
+
+		if (avx2)
+			return SIMDLevel::AVX2;
+		if (sse2)
+			return SIMDLevel::SSE2;
+#endif
+		return SIMDLevel::Scalar;
+	}
+
+	static SIMDLevel s_SIMDLevel = GetSupportedSIMDLevel();
+
+	SIMDLevel GetSupportedSIMDLevel()
+	{
+		static SIMDLevel s_Supported = DetectSIMDLevel();
+		return s_Supported;
+	}
+
+	SIMDLevel GetSIMDLevel()
+	{
+		return s_SIMDLevel;
+	}
+
+	void SetSIMDLevel(SIMDLevel level)
+	{
+		s_SIMDLevel = std::min(level, GetSupportedSIMDLevel());
+	}
+
+	const char* SIMDLevelToString(SIMDLevel level)
+	{
+		switch (level)
+		{
+			case SIMDLevel::Scalar: return "Scalar";
+			case SIMDLevel::SSE2:   return "SSE2";
+			case SIMDLevel::AVX2:   return "AVX2";
+		}
+		return "Unknown";
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Scalar ////////////////////////////////////////////////////////////////
+	//////////////////////////////////////////////////////////////////////////
+
+	static void TransformPoints2DScalar(const glm::mat4& m, const glm::vec2* in, glm::vec2* out, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			float x = in[i].x, y = in[i].y;
+			out[i].x = m[0][0] * x + m[1][0] * y + m[3][0];
+			out[i].y = m[0][1] * x + m[1][1] * y + m[3][1];
+		}
+	}
+
+	// With a = c*hx, b = s*hy, d = s*hx, e = c*hy the corners are
+	// (-a+b, -d-e), (a+b, d-e), (a-b, d+e), (-a-b, -d+e) around the position,
+	// i.e. corners 0/1 are position + k and corners 2/3 are position - k.
+	static void BuildQuadCornersScalar(const glm::vec2* positions, const glm::vec2* sizes, const float* rotations, glm::vec2* out, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			float radians = glm::radians(rotations[i]);
+			float c = cosf(radians), s = sinf(radians);
+			float hx = sizes[i].x * 0.5f, hy = sizes[i].y * 0.5f;
+			float a = c * hx, b = s * hy, d = s * hx, e = c * hy;
+
+			const glm::vec2& p = positions[i];
+			glm::vec2* corners = out + i * 4;
+			corners[0] = { p.x - a + b, p.y - d - e };
+			corners[1] = { p.x + a + b, p.y + d - e };
+			corners[2] = { p.x + a - b, p.y + d + e };
+			corners[3] = { p.x - a - b, p.y - d + e };
+		}
+	}
+
+#ifdef GLCORE_SIMD_X86
+
+	//////////////////////////////////////////////////////////////////////////
+	// SSE2 //////////////////////////////////////////////////////////////////
+	//////////////////////////////////////////////////////////////////////////
+
+	static void TransformPoints2DSSE2(const glm::mat4& m, const glm::vec2* in, glm::vec2* out, size_t count)
+	{
+		const __m128 col0 = _mm_setr_ps(m[0][0], m[0][1], m[0][0], m[0][1]);
+		const __m128 col1 = _mm_setr_ps(m[1][0], m[1][1], m[1][0], m[1][1]);
+		const __m128 col3 = _mm_setr_ps(m[3][0], m[3][1], m[3][0], m[3][1]);
+
+		const float* src = &in[0].x;
+		float* dst = &out[0].x;
+
+		size_t i = 0;
+		for (; i + 2 <= count; i += 2)
+		{
+			__m128 v = _mm_loadu_ps(src + i * 2);
+			__m128 x = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0));
+			__m128 y = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+			__m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, col0), _mm_mul_ps(y, col1)), col3);
+			_mm_storeu_ps(dst + i * 2, r);
+		}
+
+		TransformPoints2DScalar(m, in + i, out + i, count - i);
+	}
+
+	// Sin/cos stay scalar; the corner expansion is one add and one sub per
+	// quad on [x, y, x, y] lanes.
+	static void BuildQuadCornersSSE2(const glm::vec2* positions, const glm::vec2* sizes, const float* rotations, glm::vec2* out, size_t count)
+	{
+		const __m128 signA = _mm_setr_ps(-1.0f, -1.0f, 1.0f, 1.0f);
+		const __m128 signB = _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f);
+		const __m128 half = _mm_set1_ps(0.5f);
+
+		float* dst = &out[0].x;
+		for (size_t i = 0; i < count; i++)
+		{
+			float radians = glm::radians(rotations[i]);
+			float c = cosf(radians), s = sinf(radians);
+
+			__m128 cs = _mm_setr_ps(c, s, c, s);
+			__m128 sc = _mm_setr_ps(s, c, s, c);
+			__m128 hx = _mm_mul_ps(_mm_set1_ps(sizes[i].x), half);
+			__m128 hy = _mm_mul_ps(_mm_set1_ps(sizes[i].y), half);
+			__m128 k = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(cs, hx), signA), _mm_mul_ps(_mm_mul_ps(sc, hy), signB));
+
+			__m128 p = _mm_setr_ps(positions[i].x, positions[i].y, positions[i].x, positions[i].y);
+			_mm_storeu_ps(dst + i * 8 + 0, _mm_add_ps(p, k));
+			_mm_storeu_ps(dst + i * 8 + 4, _mm_sub_ps(p, k));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// AVX2 //////////////////////////////////////////////////////////////////
+	//////////////////////////////////////////////////////////////////////////
+
+	GLCORE_TARGET_AVX2
+	static void TransformPoints2DAVX2(const glm::mat4& m, const glm::vec2* in, glm::vec2* out, size_t count)
+	{
+		const __m256 col0 = _mm256_setr_ps(m[0][0], m[0][1], m[0][0], m[0][1], m[0][0], m[0][1], m[0][0], m[0][1]);
+		const __m256 col1 = _mm256_setr_ps(m[1][0], m[1][1], m[1][0], m[1][1], m[1][0], m[1][1], m[1][0], m[1][1]);
+		const __m256 col3 = _mm256_setr_ps(m[3][0], m[3][1], m[3][0], m[3][1], m[3][0], m[3][1], m[3][0], m[3][1]);
+
+		const float* src = &in[0].x;
+		float* dst = &out[0].x;
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m256 v = _mm256_loadu_ps(src + i * 2);
+			__m256 x = _mm256_moveldup_ps(v);
+			__m256 y = _mm256_movehdup_ps(v);
+			__m256 r = _mm256_fmadd_ps(x, col0, _mm256_fmadd_ps(y, col1, col3));
+			_mm256_storeu_ps(dst + i * 2, r);
+		}
+
+		TransformPoints2DScalar(m, in + i, out + i, count - i);
+	}
+
+	GLCORE_TARGET_AVX2
+	static void BuildQuadCornersAVX2(const glm::vec2* positions, const glm::vec2* sizes, const float* rotations, glm::vec2* out, size_t count)
+	{
+		const __m256 signA = _mm256_setr_ps(-1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f);
+		const __m256 signB = _mm256_setr_ps(1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f);
+		const __m256 signK = _mm256_setr_ps(1.0f, 1.0f, 1.0f, 1.0f, -1.0f, -1.0f, -1.0f, -1.0f);
+
+		float* dst = &out[0].x;
+		for (size_t i = 0; i < count; i++)
+		{
+			float radians = glm::radians(rotations[i]);
+			float c = cosf(radians), s = sinf(radians);
+			float hx = sizes[i].x * 0.5f, hy = sizes[i].y * 0.5f;
+
+			__m256 a = _mm256_mul_ps(_mm256_setr_ps(c, s, c, s, c, s, c, s), _mm256_set1_ps(hx));
+			__m256 b = _mm256_mul_ps(_mm256_setr_ps(s, c, s, c, s, c, s, c), _mm256_set1_ps(hy));
+			__m256 k = _mm256_fmadd_ps(a, signA, _mm256_mul_ps(b, signB));
+
+			__m256 p = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)&positions[i]));
+			_mm256_storeu_ps(dst + i * 8, _mm256_fmadd_ps(k, signK, p));
+		}
+	}
+
+#endif
+
+	void TransformPoints2D(const glm::mat4& matrix, const glm::vec2* in, glm::vec2* out, size_t count)
+	{
+		switch (s_SIMDLevel)
+		{
+#ifdef GLCORE_SIMD_X86
+			case SIMDLevel::AVX2: TransformPoints2DAVX2(matrix, in, out, count); return;
+			case SIMDLevel::SSE2: TransformPoints2DSSE2(matrix, in, out, count); return;
+#endif
+			default:              TransformPoints2DScalar(matrix, in, out, count); return;
+		}
+	}
+
+	void BuildQuadCorners(const glm::vec2* positions, const glm::vec2* sizes, const float* rotations, glm::vec2* outCorners, size_t count)
+	{
+		switch (s_SIMDLevel)
+		{
+#ifdef GLCORE_SIMD_X86
+			case SIMDLevel::AVX2: BuildQuadCornersAVX2(positions, sizes, rotations, outCorners, count); return;
+			case SIMDLevel::SSE2: BuildQuadCornersSSE2(positions, sizes, rotations, outCorners, count); return;
+#endif
+			default:              BuildQuadCornersScalar(positions, sizes, rotations, outCorners, count); return;
+		}
+	}
+
+	bool ValidateTransformKernels(float epsilon)
+	{
+		constexpr size_t count = 37; // Deliberately not a multiple of any vector width
+
+		std::vector<glm::vec2> points(count), sizes(count), result(count * 4);
+		std::vector<float> rotations(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			points[i] = { (float)i * 0.75f - 13.0f, 5.0f - (float)i * 0.3f };
+			sizes[i] = { 0.5f + (float)(i % 5), 1.0f + (float)(i % 3) * 0.25f };
+			rotations[i] = (float)i * 17.0f - 180.0f;
+		}
+
+		glm::mat4 matrix = glm::ortho(-1.6f, 1.6f, -0.9f, 0.9f, -1.0f, 1.0f) *
+			glm::inverse(glm::translate(glm::mat4(1.0f), { 0.4f, -1.2f, 0.0f }) *
+				glm::rotate(glm::mat4(1.0f), glm::radians(30.0f), { 0.0f, 0.0f, 1.0f }));
+
+		auto nearlyEqual = [epsilon](const glm::vec2& a, const glm::vec2& b)
+		{
+			return fabsf(a.x - b.x) <= epsilon * std::max(1.0f, fabsf(b.x)) &&
+				fabsf(a.y - b.y) <= epsilon * std::max(1.0f, fabsf(b.y));
+		};
+
+		SIMDLevel previous = s_SIMDLevel;
+		bool success = true;
+		for (int level = 0; level <= (int)GetSupportedSIMDLevel(); level++)
+		{
+			SetSIMDLevel((SIMDLevel)level);
+
+			TransformPoints2D(matrix, points.data(), result.data(), count);
+			for (size_t i = 0; i < count; i++)
+			{
+				glm::vec4 expected = matrix * glm::vec4(points[i], 0.0f, 1.0f);
+				if (!nearlyEqual(result[i], { expected.x, expected.y }))
+				{
+					LOG_ERROR("TransformPoints2D ({0}) mismatch at {1}", SIMDLevelToString((SIMDLevel)level), i);
+					success = false;
+					break;
+				}
+			}
+
+			BuildQuadCorners(points.data(), sizes.data(), rotations.data(), result.data(), count);
+			const glm::vec2 unitCorners[4] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+			for (size_t i = 0; i < count; i++)
+			{
+				glm::mat4 transform = glm::translate(glm::mat4(1.0f), { points[i].x, points[i].y, 0.0f }) *
+					glm::rotate(glm::mat4(1.0f), glm::radians(rotations[i]), { 0.0f, 0.0f, 1.0f }) *
+					glm::scale(glm::mat4(1.0f), { sizes[i].x, sizes[i].y, 1.0f });
+
+				for (int corner = 0; corner < 4; corner++)
+				{
+					glm::vec4 expected = transform * glm::vec4(unitCorners[corner], 0.0f, 1.0f);
+					if (!nearlyEqual(result[i * 4 + corner], { expected.x, expected.y }))
+					{
+						LOG_ERROR("BuildQuadCorners ({0}) mismatch at {1}", SIMDLevelToString((SIMDLevel)level), i);
+						success = false;
+						break;
+					}
+				}
+			}
+		}
+		s_SIMDLevel = previous;
+
+		return success;
+	}
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace GLCore::Utils {
+
+	enum class SIMDLevel
+	{
+		Scalar = 0, SSE2 = 1, AVX2 = 2
+	};
+
+	// Highest instruction set supported by the CPU and OS, detected once
+	SIMDLevel GetSupportedSIMDLevel();
+
+	// Level used by the kernels below; defaults to the supported level and
+	// can be lowered (e.g. for comparisons) but never raised past it
+	SIMDLevel GetSIMDLevel();
+	void SetSIMDLevel(SIMDLevel level);
+	const char* SIMDLevelToString(SIMDLevel level);
+
+	// Transforms 2D points by the affine part of a 4x4 matrix, treating each
+	// point as (x, y, 0, 1). in and out may alias.
+	void TransformPoints2D(const glm::mat4& matrix, const glm::vec2* in, glm::vec2* out, size_t count);
+
+	// Writes four corners per quad (bottom-left, bottom-right, top-right,
+	// top-left) centred on position, rotated anti-clockwise by rotation
+	// degrees. outCorners must hold 4 * count elements.
+	void BuildQuadCorners(const glm::vec2* positions, const glm::vec2* sizes, const float* rotations, glm::vec2* outCorners, size_t count);
+
+	// Runs every available kernel level against the glm reference results
+	bool ValidateTransformKernels(float epsilon = 1e-4f);
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+// Forward declarations - include into headers that only pass GLCore types
+// around by pointer or reference, and include the full headers in the .cpp
+
+#include <cstdint>
+
+namespace GLCore {
+
+	class Application;
+	class Layer;
+	class LayerStack;
+	class Window;
+	struct WindowProps;
+	class Timestep;
+	class Input;
+	class Log;
+	struct LogSpecification;
+
+	class Event;
+	class EventDispatcher;
+	enum class EventType;
+	class EventRecorder;
+	class EventReplay;
+
+	class JobCounter;
+	class JobSystem;
+
+	class RenderCommandQueue;
+	struct DrawCommand;
+	class RenderThread;
+	struct FrameData;
+	class FrameUniformBuffer;
+	class GPUTimer;
+	class MappedFile;
+	class DynamicResolution;
+	class TextRenderer;
+	struct TextRendererStats;
+
+	class FileSystem;
+	class FileData;
+	class PackedArchive;
+	struct PackedArchiveHeader;
+	struct PackedArchiveEntry;
+	struct PackOptions;
+
+	class AssetManager;
+	struct AssetManagerStats;
+	template<typename T> class AssetHandle;
+
+	class ImGuiLayer;
+
+	struct Entity;
+	class Registry;
+	struct TransformComponent;
+	struct VelocityComponent;
+	struct SpriteRendererComponent;
+	struct LocalTransform;
+	class TransformHierarchy;
+
+	namespace Utils {
+
+		class Shader;
+		class Framebuffer;
+		struct FramebufferSpecification;
+		class OrthographicCamera;
+		class OrthographicCameraController;
+		class PerspectiveCamera;
+		class PerspectiveCameraController;
+		class Mesh;
+		struct MeshData;
+		struct MeshVertex;
+		class Texture2D;
+		class Font;
+		struct FontGlyph;
+		struct TextLayout;
+		struct TextLayoutGlyph;
+
+	}
+
+}
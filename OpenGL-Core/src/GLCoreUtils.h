@@ -5,4 +5,13 @@
 #include "GLCore/Util/Shader.h"
 #include "GLCore/Util/OrthographicCamera.h"
 #include "GLCore/Util/OrthographicCameraController.h"
-#include "GLCore/Util/OpenGLDebug.h"
\ No newline at end of file
+#include "GLCore/Util/PerspectiveCamera.h"
+#include "GLCore/Util/PerspectiveCameraController.h"
+#include "GLCore/Util/OpenGLDebug.h"
+#include "GLCore/Util/TransformKernels.h"
+#include "GLCore/Util/Framebuffer.h"
+#include "GLCore/Util/Mesh.h"
+#include "GLCore/Util/MeshCooker.h"
+#include "GLCore/Util/Texture.h"
+#include "GLCore/Util/Font.h"
+#include "GLCore/Util/FontCooker.h"
\ No newline at end of file
@@ -1,5 +1,5 @@
 #include "glpch.h"
-#include "WindowsWindow.h"
+#include "GlfwWindow.h"
 
 #include "GLCore/Events/ApplicationEvent.h"
 #include "GLCore/Events/MouseEvent.h"
@@ -17,22 +17,17 @@ namespace GLCore {
 		LOG_ERROR("GLFW Error ({0}): {1}", error, description);
 	}
 
-	Window* Window::Create(const WindowProps& props)
-	{
-		return new WindowsWindow(props);
-	}
-
-	WindowsWindow::WindowsWindow(const WindowProps& props)
+	GlfwWindow::GlfwWindow(const WindowProps& props)
 	{
 		Init(props);
 	}
 
-	WindowsWindow::~WindowsWindow()
+	GlfwWindow::~GlfwWindow()
 	{
 		Shutdown();
 	}
 
-	void WindowsWindow::Init(const WindowProps& props)
+	void GlfwWindow::Init(const WindowProps& props)
 	{
 		m_Data.Title = props.Title;
 		m_Data.Width = props.Width;
@@ -40,22 +35,47 @@ namespace GLCore {
 
 		if (!s_GLFWInitialized)
 		{
-			int success = glfwInit();
-			GLCORE_ASSERT(success, "Could not intialize GLFW!");
 			glfwSetErrorCallback(GLFWErrorCallback);
+			if (!glfwInit())
+			{
+				LOG_ERROR("Could not initialize GLFW!");
+				return;
+			}
 			s_GLFWInitialized = true;
 		}
 
+	#if defined(GLCORE_PLATFORM_LINUX)
+		// Mesa and most Linux drivers hand out a 3.x compatibility context
+		// unless asked; the core relies on 4.5 direct state access
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	#endif
+	#if defined(GLCORE_PLATFORM_LINUX) && defined(GLCORE_DEBUG)
+		glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
+	#endif
+		glfwWindowHint(GLFW_VISIBLE, props.Visible ? GLFW_TRUE : GLFW_FALSE);
+
 		m_Window = glfwCreateWindow((int)props.Width, (int)props.Height, m_Data.Title.c_str(), nullptr, nullptr);
+		if (!m_Window)
+		{
+			LOG_ERROR("Could not create a window with an OpenGL 4.5 context!");
+			return;
+		}
 
 		glfwMakeContextCurrent(m_Window);
-		int status = gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
-		GLCORE_ASSERT(status, "Failed to initialize Glad!");
+		if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+		{
+			LOG_ERROR("Failed to initialize Glad!");
+			glfwDestroyWindow(m_Window);
+			m_Window = nullptr;
+			return;
+		}
 
 		LOG_INFO("OpenGL Info:");
-		LOG_INFO("  Vendor: {0}", glGetString(GL_VENDOR));
-		LOG_INFO("  Renderer: {0}", glGetString(GL_RENDERER));
-		LOG_INFO("  Version: {0}", glGetString(GL_VERSION));
+		LOG_INFO("  Vendor: {0}", (const char*)glGetString(GL_VENDOR));
+		LOG_INFO("  Renderer: {0}", (const char*)glGetString(GL_RENDERER));
+		LOG_INFO("  Version: {0}", (const char*)glGetString(GL_VERSION));
 
 		glfwSetWindowUserPointer(m_Window, &m_Data);
 		SetVSync(true);
@@ -151,18 +171,42 @@ namespace GLCore {
 		});
 	}
 
-	void WindowsWindow::Shutdown()
+	void GlfwWindow::Shutdown()
 	{
-		glfwDestroyWindow(m_Window);
+		if (m_Window)
+			glfwDestroyWindow(m_Window);
 	}
 
-	void WindowsWindow::OnUpdate()
+	void GlfwWindow::OnUpdate()
+	{
+		PollEvents();
+		SwapBuffers();
+	}
+
+	void GlfwWindow::PollEvents()
 	{
 		glfwPollEvents();
+	}
+
+	void GlfwWindow::WaitEvents(double timeout)
+	{
+		if (timeout > 0.0)
+			glfwWaitEventsTimeout(timeout);
+		else
+			glfwWaitEvents();
+	}
+
+	void GlfwWindow::PostEmptyEvent()
+	{
+		glfwPostEmptyEvent();
+	}
+
+	void GlfwWindow::SwapBuffers()
+	{
 		glfwSwapBuffers(m_Window);
 	}
 
-	void WindowsWindow::SetVSync(bool enabled)
+	void GlfwWindow::SetVSync(bool enabled)
 	{
 		if (enabled)
 			glfwSwapInterval(1);
@@ -172,7 +216,7 @@ namespace GLCore {
 		m_Data.VSync = enabled;
 	}
 
-	bool WindowsWindow::IsVSync() const
+	bool GlfwWindow::IsVSync() const
 	{
 		return m_Data.VSync;
 	}
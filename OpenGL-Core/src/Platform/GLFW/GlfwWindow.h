@@ -6,13 +6,19 @@
 
 namespace GLCore {
 
-	class WindowsWindow : public Window
+	// Window and GL context through GLFW, used on every desktop platform;
+	// the few platform differences are #ifdefs in GlfwWindow.cpp
+	class GlfwWindow : public Window
 	{
 	public:
-		WindowsWindow(const WindowProps& props);
-		virtual ~WindowsWindow();
+		GlfwWindow(const WindowProps& props);
+		virtual ~GlfwWindow();
 
 		void OnUpdate() override;
+		void PollEvents() override;
+		void WaitEvents(double timeout) override;
+		void PostEmptyEvent() override;
+		void SwapBuffers() override;
 
 		inline uint32_t GetWidth() const override { return m_Data.Width; }
 		inline uint32_t GetHeight() const override { return m_Data.Height; }
@@ -27,7 +33,7 @@ namespace GLCore {
 		virtual void Init(const WindowProps& props);
 		virtual void Shutdown();
 	private:
-		GLFWwindow* m_Window;
+		GLFWwindow* m_Window = nullptr; // Null if Init failed
 
 		struct WindowData
 		{
@@ -0,0 +1,53 @@
+#include "glpch.h"
+#include "GLCore/Core/MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace GLCore {
+
+	bool MappedFile::Open(const std::string& filepath)
+	{
+		Close();
+
+		int file = open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+		if (file < 0)
+		{
+			LOG_ERROR("Could not open file '{0}'", filepath);
+			return false;
+		}
+
+		struct stat info;
+		if (fstat(file, &info) != 0 || info.st_size == 0)
+		{
+			LOG_ERROR("Could not map empty or unreadable file '{0}'", filepath);
+			close(file);
+			return false;
+		}
+
+		// The mapping keeps its own reference to the file
+		void* data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);
+		if (data == MAP_FAILED)
+		{
+			LOG_ERROR("Could not map file '{0}'", filepath);
+			return false;
+		}
+
+		m_Data = (const uint8_t*)data;
+		m_Size = (size_t)info.st_size;
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			munmap((void*)m_Data, m_Size);
+
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+
+}
@@ -0,0 +1,56 @@
+#include "glpch.h"
+#include "GLCore/Core/MappedFile.h"
+
+namespace GLCore {
+
+	bool MappedFile::Open(const std::string& filepath)
+	{
+		Close();
+
+		HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			LOG_ERROR("Could not open file '{0}'", filepath);
+			return false;
+		}
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			LOG_ERROR("Could not map empty or unreadable file '{0}'", filepath);
+			CloseHandle(file);
+			return false;
+		}
+
+		// The view keeps the mapping and file alive after their handles close
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (!mapping)
+		{
+			LOG_ERROR("Could not map file '{0}'", filepath);
+			return false;
+		}
+
+		void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+		if (!data)
+		{
+			LOG_ERROR("Could not map file '{0}'", filepath);
+			return false;
+		}
+
+		m_Data = (const uint8_t*)data;
+		m_Size = (size_t)size.QuadPart;
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+
+}
@@ -1,17 +1,15 @@
+
 #pragma once
 
-#include <iostream>
 #include <memory>
 #include <utility>
 #include <algorithm>
-#include <functional>
 
 #include <string>
-#include <sstream>
 #include <vector>
-#include <unordered_map>
-#include <unordered_set>
 
+// Most translation units log, so spdlog is parsed once here rather than in each
+#include "GLCore/Core/Core.h"
 #include "GLCore/Core/Log.h"
 
 #ifdef GLCORE_PLATFORM_WINDOWS
@@ -2,9 +2,21 @@
 
 layout (location = 0) in vec3 a_Position;
 
-uniform mat4 u_ViewProjection;
+layout (std140) uniform FrameData
+{
+	mat4 u_ViewProjection;
+	mat4 u_View;
+	mat4 u_Projection;
+	mat4 u_InverseViewProjection;
+	vec4 u_Viewport;
+	float u_Time;
+	float u_DeltaTime;
+	uint u_FrameIndex;
+};
+
+uniform mat4 u_Transform;
 
 void main()
 {
-	gl_Position = u_ViewProjection * vec4(a_Position, 1.0f);
+	gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0f);
 }
\ No newline at end of file
@@ -1,20 +1,78 @@
 #include "GLCore.h"
+#include "GLCoreUtils.h"
 #include "ExampleLayer.h"
 
+#include <cstring>
+#include <filesystem>
+
 using namespace GLCore;
 
+// The example font comes from Dear ImGui. It is copied into the assets, so
+// that it is cooked there instead of inside the submodule and gets packed.
+static const char* s_FontSource = "../OpenGL-Core/vendor/imgui/misc/fonts/Roboto-Medium.ttf";
+static const char* s_FontAsset = "assets/fonts/Roboto-Medium.ttf";
+
+static void CopyExampleFont()
+{
+	namespace fs = std::filesystem;
+
+	std::error_code error;
+	if (!fs::exists(s_FontSource, error))
+		return;
+
+	fs::create_directories(fs::path(s_FontAsset).parent_path(), error);
+	fs::copy_file(s_FontSource, s_FontAsset, fs::copy_options::update_existing, error);
+	if (error)
+		LOG_WARN("Could not copy the example font: {0}", error.message());
+}
+
 class Example : public Application
 {
 public:
 	Example()
 		: Application("OpenGL Examples")
 	{
+		// A packed build ships assets.glpak instead of the assets directory
+		if (std::filesystem::exists("assets.glpak"))
+			FileSystem::Mount("assets", "assets.glpak");
+		CopyExampleFont();
+
 		PushLayer(new ExampleLayer());
+
+		// The controls only change in response to input
+		GetImGuiLayer().SetIdleMode(true);
 	}
 };
 
-int main()
+// Cooks every mesh and font, then packs the assets directory into assets.glpak
+static bool PackAssets()
 {
+	CopyExampleFont();
+
+	std::error_code error;
+	for (const auto& entry : std::filesystem::recursive_directory_iterator("assets", error))
+	{
+		std::string path = entry.path().generic_string(), cookedPath;
+		std::filesystem::path extension = entry.path().extension();
+		if (extension == ".obj" && !Utils::EnsureCookedMesh(path, cookedPath))
+			return false;
+		if ((extension == ".ttf" || extension == ".otf") && !Utils::EnsureCookedFont(path, cookedPath))
+			return false;
+	}
+
+	return !error && PackDirectory("assets", "assets.glpak");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc == 2 && !strcmp(argv[1], "--pack-assets"))
+	{
+		Log::Init();
+		bool success = PackAssets();
+		Log::Shutdown();
+		return success ? 0 : 1;
+	}
+
 	std::unique_ptr<Example> app = std::make_unique<Example>();
 	app->Run();
-}
\ No newline at end of file
+}
@@ -22,39 +22,19 @@ void ExampleLayer::OnAttach()
 	glEnable(GL_BLEND);
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-	m_Shader = Shader::FromGLSLTextFiles(
-		"assets/shaders/test.vert.glsl",
-		"assets/shaders/test.frag.glsl"
-	);
-
-	glCreateVertexArrays(1, &m_QuadVA);
-	glBindVertexArray(m_QuadVA);
-
-	float vertices[] = {
-		-0.5f, -0.5f, 0.0f,
-		 0.5f, -0.5f, 0.0f,
-		 0.5f,  0.5f, 0.0f,
-		-0.5f,  0.5f, 0.0f
-	};
-
-	glCreateBuffers(1, &m_QuadVB);
-	glBindBuffer(GL_ARRAY_BUFFER, m_QuadVB);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(float) * 3, 0);
-
-	uint32_t indices[] = { 0, 1, 2, 2, 3, 0 };
-	glCreateBuffers(1, &m_QuadIB);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_QuadIB);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+	// All load in the background and are drawn once they are ready. The
+	// mesh and font are cooked to .glmesh and .glfont files on first run.
+	AssetManager& assets = Application::Get().GetAssetManager();
+	m_Shader = assets.Load<Shader>("assets/shaders/test");
+	m_QuadMesh = assets.Load<Mesh>("assets/meshes/quad.obj");
+	m_Font = assets.Load<Font>("assets/fonts/Roboto-Medium.ttf");
 }
 
 void ExampleLayer::OnDetach()
 {
-	glDeleteVertexArrays(1, &m_QuadVA);
-	glDeleteBuffers(1, &m_QuadVB);
-	glDeleteBuffers(1, &m_QuadIB);
+	m_Shader.Reset();
+	m_QuadMesh.Reset();
+	m_Font.Reset();
 }
 
 void ExampleLayer::OnEvent(Event& event)
@@ -83,16 +63,43 @@ void ExampleLayer::OnUpdate(Timestep ts)
 	glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-	glUseProgram(m_Shader->GetRendererID());
-
-	int location = glGetUniformLocation(m_Shader->GetRendererID(), "u_ViewProjection");
-	glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(m_CameraController.GetCamera().GetViewProjectionMatrix()));
-
-	location = glGetUniformLocation(m_Shader->GetRendererID(), "u_Color");
-	glUniform4fv(location, 1, glm::value_ptr(m_SquareColor));
-
-	glBindVertexArray(m_QuadVA);
-	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+	// Recording may happen on any job system thread; Execute stays on this one
+	if (m_Shader.IsReady() && m_QuadMesh.IsReady())
+	{
+		DrawCommand command;
+		command.Shader = m_Shader.Get();
+		command.VertexArray = m_QuadMesh->GetVertexArray();
+		command.IndexCount = m_QuadMesh->GetIndexCount();
+		command.Color = m_SquareColor;
+		command.SortKey = MakeSortKey(command.Shader->GetRendererID(), 0, 0.0f);
+		m_RenderQueue.Submit(command);
+	}
+
+	// The camera reaches the shader through the FrameData block
+	const OrthographicCamera& camera = m_CameraController.GetCamera();
+	Window& window = Application::Get().GetWindow();
+	m_Time += ts;
+
+	FrameData frame;
+	frame.ViewProjection = camera.GetViewProjectionMatrix();
+	frame.View = camera.GetViewMatrix();
+	frame.Projection = camera.GetProjectionMatrix();
+	frame.InverseViewProjection = camera.GetInverseViewProjectionMatrix();
+	frame.Viewport = { (float)window.GetWidth(), (float)window.GetHeight(), 1.0f / (float)window.GetWidth(), 1.0f / (float)window.GetHeight() };
+	frame.Time = m_Time;
+	frame.DeltaTime = ts;
+	m_FrameUniforms.Update(frame);
+
+	m_RenderQueue.Execute();
+	m_RenderQueue.Clear();
+
+	if (m_Font.IsReady())
+	{
+		m_TextRenderer.Begin(camera.GetViewProjectionMatrix());
+		m_TextRenderer.DrawString(*m_Font, "OpenGL-Core", { -0.5f, 0.6f, 0.0f }, 0.2f, m_SquareColor);
+		m_TextRenderer.DrawString(*m_Font, "Click to change color", { -0.5f, -0.75f, 0.0f }, 0.08f, { 0.8f, 0.8f, 0.8f, 1.0f });
+		m_TextRenderer.End();
+	}
 }
 
 void ExampleLayer::OnImGuiRender()
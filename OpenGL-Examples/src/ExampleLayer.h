@@ -15,10 +15,14 @@ public:
 	virtual void OnUpdate(GLCore::Timestep ts) override;
 	virtual void OnImGuiRender() override;
 private:
-	GLCore::Utils::Shader* m_Shader;
+	GLCore::AssetHandle<GLCore::Utils::Shader> m_Shader;
 	GLCore::Utils::OrthographicCameraController m_CameraController;
-	
-	GLuint m_QuadVA, m_QuadVB, m_QuadIB;
+	GLCore::RenderCommandQueue m_RenderQueue;
+	GLCore::FrameUniformBuffer m_FrameUniforms;
+	float m_Time = 0.0f;
+	GLCore::AssetHandle<GLCore::Utils::Mesh> m_QuadMesh;
+	GLCore::AssetHandle<GLCore::Utils::Font> m_Font;
+	GLCore::TextRenderer m_TextRenderer;
 
 	glm::vec4 m_SquareBaseColor = { 0.8f, 0.2f, 0.3f, 1.0f };
 	glm::vec4 m_SquareAlternateColor = { 0.2f, 0.3f, 0.8f, 1.0f };
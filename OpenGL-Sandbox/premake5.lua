@@ -23,6 +23,11 @@ project "OpenGL-Sandbox"
 		"../OpenGL-Core/%{IncludeDir.ImGui}"
 	}
 
+	defines
+	{
+		"SPDLOG_COMPILED_LIB"
+	}
+
 	links
 	{
 		"OpenGL-Core"
@@ -36,6 +41,29 @@ project "OpenGL-Sandbox"
 			"GLCORE_PLATFORM_WINDOWS"
 		}
 
+	filter "system:linux"
+		defines
+		{
+			"GLCORE_PLATFORM_LINUX"
+		}
+
+		-- Static libraries do not carry their dependencies on Linux, and GNU ld
+		-- resolves symbols left to right
+		links
+		{
+			"GLFW",
+			"Glad",
+			"ImGui",
+			"GL",
+			"X11",
+			"Xrandr",
+			"Xi",
+			"Xcursor",
+			"Xinerama",
+			"dl",
+			"pthread"
+		}
+
 	filter "configurations:Debug"
 		defines "GLCORE_DEBUG"
 		runtime "Debug"
@@ -0,0 +1,148 @@
+# Build configurations, optimization options and benchmark helpers shared by
+# every GLCore target.
+
+include(CheckIPOSupported)
+
+option(GLCORE_ENABLE_LTO "Build with link-time optimization" OFF)
+option(GLCORE_UNITY_BUILD "Compile GLCore targets as unity (jumbo) translation units" OFF)
+option(GLCORE_NATIVE_ARCH "Optimize for the host CPU (-march=native / /arch:AVX2)" OFF)
+set(GLCORE_PGO "OFF" CACHE STRING "Profile-guided optimization stage: OFF, GENERATE or USE")
+set_property(CACHE GLCORE_PGO PROPERTY STRINGS OFF GENERATE USE)
+set(GLCORE_PGO_DIR "${CMAKE_BINARY_DIR}/pgo-profiles" CACHE PATH "Directory holding PGO profile data")
+
+# Profile: optimized like Release, plus symbols and frame pointers for
+# sampling profilers and GLCORE_PROFILE, which compiles in the
+# GLCORE_PROFILE_SCOPE timers (see GLCore/Core/Profile.h)
+get_property(GLCORE_MULTI_CONFIG GLOBAL PROPERTY GENERATOR_IS_MULTI_CONFIG)
+if(GLCORE_MULTI_CONFIG)
+	set(CMAKE_CONFIGURATION_TYPES "Debug;Release;Profile" CACHE STRING "" FORCE)
+elseif(NOT CMAKE_BUILD_TYPE)
+	set(CMAKE_BUILD_TYPE "Release" CACHE STRING "Debug, Release or Profile" FORCE)
+endif()
+
+if(MSVC)
+	set(CMAKE_CXX_FLAGS_PROFILE "/O2 /Ob2 /DNDEBUG /Zi /Oy-" CACHE STRING "" FORCE)
+	set(CMAKE_C_FLAGS_PROFILE "/O2 /Ob2 /DNDEBUG /Zi /Oy-" CACHE STRING "" FORCE)
+	set(CMAKE_EXE_LINKER_FLAGS_PROFILE "/DEBUG /OPT:REF /OPT:ICF" CACHE STRING "" FORCE)
+else()
+	set(CMAKE_CXX_FLAGS_PROFILE "-O3 -DNDEBUG -g -fno-omit-frame-pointer" CACHE STRING "" FORCE)
+	set(CMAKE_C_FLAGS_PROFILE "-O3 -DNDEBUG -g -fno-omit-frame-pointer" CACHE STRING "" FORCE)
+	set(CMAKE_EXE_LINKER_FLAGS_PROFILE "" CACHE STRING "" FORCE)
+endif()
+mark_as_advanced(CMAKE_CXX_FLAGS_PROFILE CMAKE_C_FLAGS_PROFILE CMAKE_EXE_LINKER_FLAGS_PROFILE)
+
+if(GLCORE_ENABLE_LTO)
+	check_ipo_supported(RESULT GLCORE_LTO_SUPPORTED OUTPUT GLCORE_LTO_ERROR LANGUAGES C CXX)
+	if(NOT GLCORE_LTO_SUPPORTED)
+		message(WARNING "LTO is not supported by this toolchain: ${GLCORE_LTO_ERROR}")
+	endif()
+endif()
+
+if(NOT GLCORE_PGO STREQUAL "OFF")
+	if(NOT GLCORE_PGO MATCHES "^(GENERATE|USE)$")
+		message(FATAL_ERROR "GLCORE_PGO must be OFF, GENERATE or USE")
+	endif()
+	if(NOT CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+		message(FATAL_ERROR "GLCORE_PGO is only supported with GCC and Clang")
+	endif()
+	if(GLCORE_PGO STREQUAL "USE" AND NOT EXISTS "${GLCORE_PGO_DIR}")
+		message(FATAL_ERROR "No PGO profiles in ${GLCORE_PGO_DIR}; build and run pgo-train with GLCORE_PGO=GENERATE first")
+	endif()
+endif()
+
+# Applies the optimization options to any compiled target, vendor
+# libraries included
+function(glcore_apply_optimizations target)
+	get_target_property(type ${target} TYPE)
+	if(type STREQUAL "INTERFACE_LIBRARY")
+		return()
+	endif()
+
+	if(GLCORE_ENABLE_LTO AND GLCORE_LTO_SUPPORTED)
+		set_property(TARGET ${target} PROPERTY INTERPROCEDURAL_OPTIMIZATION ON)
+	endif()
+
+	if(GLCORE_NATIVE_ARCH)
+		if(MSVC)
+			target_compile_options(${target} PRIVATE /arch:AVX2)
+		else()
+			target_compile_options(${target} PRIVATE -march=native)
+		endif()
+	endif()
+
+	if(GLCORE_PGO STREQUAL "GENERATE")
+		if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+			target_compile_options(${target} PRIVATE -fprofile-generate -fprofile-dir=${GLCORE_PGO_DIR})
+			target_link_options(${target} PRIVATE -fprofile-generate)
+		else()
+			target_compile_options(${target} PRIVATE -fprofile-instr-generate=${GLCORE_PGO_DIR}/%m-%p.profraw)
+			target_link_options(${target} PRIVATE -fprofile-instr-generate)
+		endif()
+	elseif(GLCORE_PGO STREQUAL "USE")
+		if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+			target_compile_options(${target} PRIVATE -fprofile-use -fprofile-dir=${GLCORE_PGO_DIR} -fprofile-correction -Wno-missing-profile)
+		else()
+			target_compile_options(${target} PRIVATE -fprofile-instr-use=${GLCORE_PGO_DIR}/merged.profdata -Wno-profile-instr-unprofiled)
+		endif()
+	endif()
+endfunction()
+
+# Configuration and platform defines plus optimizations for GLCore targets
+function(glcore_configure_target target)
+	target_compile_definitions(${target} PRIVATE
+		$<$<CONFIG:Debug>:GLCORE_DEBUG>
+		$<$<CONFIG:Release>:GLCORE_RELEASE>
+		$<$<CONFIG:Profile>:GLCORE_RELEASE GLCORE_PROFILE>
+	)
+
+	if(WIN32)
+		target_compile_definitions(${target} PRIVATE GLCORE_PLATFORM_WINDOWS _CRT_SECURE_NO_WARNINGS)
+	elseif(UNIX AND NOT APPLE)
+		target_compile_definitions(${target} PRIVATE GLCORE_PLATFORM_LINUX)
+	endif()
+
+	if(GLCORE_UNITY_BUILD)
+		set_target_properties(${target} PROPERTIES UNITY_BUILD ON UNITY_BUILD_BATCH_SIZE 16)
+	endif()
+
+	glcore_apply_optimizations(${target})
+endfunction()
+
+# Registers a benchmark executable with CTest (label "benchmark") and with the
+# pgo-train target. Benchmarks write their results as JSON to --output.
+function(glcore_add_benchmark target)
+	set(output "${CMAKE_BINARY_DIR}/benchmark-results/${target}.json")
+	add_test(NAME ${target} COMMAND ${target} --output ${output} WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR})
+	set_tests_properties(${target} PROPERTIES LABELS benchmark RUN_SERIAL ON)
+	set_property(GLOBAL APPEND PROPERTY GLCORE_BENCHMARK_TARGETS ${target})
+	set_property(GLOBAL APPEND PROPERTY GLCORE_BENCHMARK_DIRECTORIES ${CMAKE_CURRENT_SOURCE_DIR})
+endfunction()
+
+# pgo-train runs every registered benchmark to collect profiles
+function(glcore_add_pgo_train_target)
+	get_property(targets GLOBAL PROPERTY GLCORE_BENCHMARK_TARGETS)
+	get_property(directories GLOBAL PROPERTY GLCORE_BENCHMARK_DIRECTORIES)
+
+	set(commands COMMAND ${CMAKE_COMMAND} -E make_directory ${GLCORE_PGO_DIR} ${CMAKE_BINARY_DIR}/benchmark-results)
+	foreach(target directory IN ZIP_LISTS targets directories)
+		list(APPEND commands COMMAND ${CMAKE_COMMAND} -E chdir ${directory} $<TARGET_FILE:${target}> --output ${CMAKE_BINARY_DIR}/benchmark-results/${target}.json)
+	endforeach()
+
+	if(GLCORE_PGO STREQUAL "GENERATE" AND CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+		# find_program(... REQUIRED) needs CMake 3.18
+		find_program(GLCORE_LLVM_PROFDATA llvm-profdata)
+		if(NOT GLCORE_LLVM_PROFDATA)
+			message(FATAL_ERROR "GLCORE_PGO=GENERATE with Clang needs llvm-profdata to merge profiles; install it or set GLCORE_LLVM_PROFDATA")
+		endif()
+		list(APPEND commands COMMAND sh -c "${GLCORE_LLVM_PROFDATA} merge -output=${GLCORE_PGO_DIR}/merged.profdata ${GLCORE_PGO_DIR}/*.profraw")
+	endif()
+
+	if(NOT targets)
+		list(APPEND commands COMMAND ${CMAKE_COMMAND} -E echo "No benchmarks registered")
+	endif()
+
+	add_custom_target(pgo-train ${commands} COMMENT "Running benchmarks for PGO training" VERBATIM)
+	if(targets)
+		add_dependencies(pgo-train ${targets})
+	endif()
+endfunction()
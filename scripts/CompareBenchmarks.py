@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+"""Compares two OpenGL-Benchmarks JSON result files.
+
+    scripts/CompareBenchmarks.py baseline.json current.json [--threshold 5]
+
+Prints the change in mean and p99 per benchmark. Changes larger than the
+threshold (percent) that also exceed the combined standard deviation are
+flagged; the exit code is 1 if any benchmark regressed.
+"""
+
+import argparse
+import json
+import math
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        results = json.load(f)
+    return {b["name"]: b for b in results["benchmarks"] if "skipped" not in b}
+
+
+def percent(old, new):
+    return 100.0 * (new - old) / old if old > 0 else 0.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=5.0, help="percent change considered significant")
+    options = parser.parse_args()
+
+    baseline, current = load(options.baseline), load(options.current)
+
+    regressions = 0
+    print(f"{'benchmark':<52} {'mean (ns)':>12} {'change':>8} {'p99 change':>11}")
+    for name in sorted(set(baseline) & set(current)):
+        old, new = baseline[name], current[name]
+        change = percent(old["mean"], new["mean"])
+        noise = math.hypot(old["stddev"], new["stddev"])
+
+        flag = ""
+        if abs(change) >= options.threshold and abs(new["mean"] - old["mean"]) > noise:
+            flag = "  slower" if change > 0 else "  faster"
+            regressions += change > 0
+
+        print(f"{name:<52} {new['mean']:12.1f} {change:+7.1f}% {percent(old['p99'], new['p99']):+10.1f}%{flag}")
+
+    for name in sorted(set(current) - set(baseline)):
+        print(f"{name:<52} {current[name]['mean']:12.1f}      new")
+    for name in sorted(set(baseline) - set(current)):
+        print(f"{name:<52} {'':>12}  missing")
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
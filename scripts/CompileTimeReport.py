@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""Per translation unit compile-time report.
+
+Re-runs every compile command from a CMake build's compile_commands.json and
+reports wall time and preprocessed size per translation unit, slowest first.
+With Clang, --time-trace adds the headers that cost the most to parse.
+
+    cmake -S . -B build -DCMAKE_BUILD_TYPE=Release
+    scripts/CompileTimeReport.py build [--filter GLCore] [--json report.json]
+"""
+
+import argparse
+import json
+import os
+import shlex
+import subprocess
+import sys
+import tempfile
+import time
+from collections import defaultdict
+
+
+def load_commands(build_dir, name_filter):
+    path = os.path.join(build_dir, "compile_commands.json")
+    if not os.path.exists(path):
+        sys.exit(f"{path} not found; configure with CMake first")
+
+    with open(path) as f:
+        entries = json.load(f)
+
+    return [e for e in entries if not name_filter or name_filter in e["file"]]
+
+
+def split_command(entry):
+    if "arguments" in entry:
+        return list(entry["arguments"])
+    return shlex.split(entry["command"])
+
+
+def replace_output(args, output):
+    args = list(args)
+    if "-o" in args:
+        args[args.index("-o") + 1] = output
+    else:
+        args += ["-o", output]
+    return args
+
+
+def preprocessed_lines(args, directory):
+    args = [a for a in replace_output(args, os.devnull) if a != "-c"]
+    # Drop dependency file generation, it would clobber the build's .d files
+    filtered, skip = [], False
+    for a in args:
+        if skip:
+            skip = False
+            continue
+        if a in ("-MF", "-MT", "-MQ"):
+            skip = True
+            continue
+        if a in ("-MD", "-MMD"):
+            continue
+        filtered.append(a)
+
+    filtered = replace_output(filtered, "-") + ["-E"]
+    result = subprocess.run(filtered, cwd=directory, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+    return result.stdout.count(b"\n") if result.returncode == 0 else 0
+
+
+def time_trace_headers(trace_path, totals):
+    try:
+        with open(trace_path) as f:
+            trace = json.load(f)
+    except (OSError, ValueError):
+        return
+
+    for event in trace.get("traceEvents", []):
+        if event.get("name") == "Source" and "dur" in event:
+            totals[event["args"]["detail"]] += event["dur"] / 1000.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("build_dir")
+    parser.add_argument("--filter", help="only translation units whose path contains this string")
+    parser.add_argument("--time-trace", action="store_true", help="collect header costs with Clang's -ftime-trace")
+    parser.add_argument("--top", type=int, default=20)
+    parser.add_argument("--json", help="also write the report to this file")
+    options = parser.parse_args()
+
+    entries = load_commands(options.build_dir, options.filter)
+    if not entries:
+        sys.exit("No matching translation units")
+
+    results = []
+    header_costs = defaultdict(float)
+    with tempfile.TemporaryDirectory() as scratch:
+        for i, entry in enumerate(entries):
+            output = os.path.join(scratch, f"tu{i}.o")
+            args = replace_output(split_command(entry), output)
+            if options.time_trace:
+                args.append("-ftime-trace")
+
+            start = time.perf_counter()
+            result = subprocess.run(args, cwd=entry["directory"], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+            elapsed = time.perf_counter() - start
+
+            if options.time_trace:
+                time_trace_headers(os.path.splitext(output)[0] + ".json", header_costs)
+
+            results.append({
+                "file": os.path.relpath(entry["file"]),
+                "seconds": round(elapsed, 3),
+                "preprocessed_lines": preprocessed_lines(split_command(entry), entry["directory"]),
+                "ok": result.returncode == 0,
+            })
+            print(f"[{i + 1}/{len(entries)}] {elapsed:6.2f}s {results[-1]['file']}", file=sys.stderr)
+
+    results.sort(key=lambda r: r["seconds"], reverse=True)
+    total = sum(r["seconds"] for r in results)
+
+    print(f"\n{'seconds':>8} {'share':>6} {'pp lines':>9}  translation unit")
+    for r in results[:options.top]:
+        flag = "" if r["ok"] else "  (failed)"
+        print(f"{r['seconds']:8.2f} {100.0 * r['seconds'] / total:5.1f}% {r['preprocessed_lines']:9d}  {r['file']}{flag}")
+    print(f"{total:8.2f}s total over {len(results)} translation units")
+
+    headers = sorted(header_costs.items(), key=lambda h: h[1], reverse=True)[:options.top]
+    if headers:
+        print(f"\n{'ms':>10}  header (summed over all translation units)")
+        for header, ms in headers:
+            print(f"{ms:10.1f}  {header}")
+
+    if options.json:
+        with open(options.json, "w") as f:
+            json.dump({"total_seconds": total, "translation_units": results,
+                       "headers": [{"file": h, "ms": ms} for h, ms in headers]}, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,6 @@
+#!/bin/bash
+
+# premake5 is not bundled for Linux; use the one on PATH
+pushd "$(dirname "$0")/.." > /dev/null
+premake5 gmake2
+popd > /dev/null